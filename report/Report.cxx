@@ -0,0 +1,37 @@
+#include "Report_Ranges.hxx"
+#include "Report_Size.hxx"
+#include "Report_Time.hxx"
+
+#include <iostream>
+#include <string>
+
+/// arg[1]: Report, `time` or `size`;
+/// arg[2]: luaocct_ranges.tsv of the export directory;
+/// arg[3]: Directory of the clang -ftime-trace files for `time`; the
+///         bindings library, its `nm -C -S -l` listing or its GNU ld map for
+///         `size`;
+/// arg[4]: Number of entries listed, 30 by default;
+int main(int argc, char const *argv[]) {
+  if (argc < 4) {
+    std::cerr << "Args?\n";
+    return 1;
+  }
+
+  std::string aReport = argv[1];
+  std::size_t aTop = argc > 4 ? std::stoul(argv[4]) : 30;
+
+  Report_Ranges aRanges{};
+
+  if (!aRanges.Load(argv[2]))
+    return 1;
+
+  if (aReport == "time")
+    return Report_Time(aRanges, argv[3], aTop) ? 0 : 2;
+
+  if (aReport == "size")
+    return Report_Size(aRanges, argv[3], aTop) ? 0 : 2;
+
+  std::cerr << "Unknown report: " << aReport << '\n';
+
+  return 1;
+}
@@ -0,0 +1,210 @@
+#include "Report_Json.hxx"
+
+#include <cstdlib>
+
+class Report_JsonParser {
+public:
+  explicit Report_JsonParser(const std::string &theText)
+      : myText(theText), myPos(0) {}
+
+  bool Parse(Report_Json &theValue) {
+    if (!parseValue(theValue))
+      return false;
+
+    skipSpaces();
+
+    return myPos == myText.size();
+  }
+
+private:
+  void skipSpaces() {
+    while (myPos < myText.size() &&
+           (myText[myPos] == ' ' || myText[myPos] == '\t' ||
+            myText[myPos] == '\n' || myText[myPos] == '\r'))
+      myPos++;
+  }
+
+  bool consume(const char *theWord) {
+    std::size_t aLen = std::char_traits<char>::length(theWord);
+
+    if (myText.compare(myPos, aLen, theWord) != 0)
+      return false;
+
+    myPos += aLen;
+
+    return true;
+  }
+
+  bool parseValue(Report_Json &theValue) {
+    skipSpaces();
+
+    if (myPos == myText.size())
+      return false;
+
+    switch (myText[myPos]) {
+    case '{':
+      return parseObject(theValue);
+    case '[':
+      return parseArray(theValue);
+    case '"':
+      theValue.myKind = Report_Json::Kind::String;
+      return parseString(theValue.myString);
+    case 't':
+      theValue.myKind = Report_Json::Kind::Boolean;
+      theValue.myNumber = 1;
+      return consume("true");
+    case 'f':
+      theValue.myKind = Report_Json::Kind::Boolean;
+      return consume("false");
+    case 'n':
+      return consume("null");
+    default:
+      return parseNumber(theValue);
+    }
+  }
+
+  bool parseNumber(Report_Json &theValue) {
+    const char *aBegin = myText.c_str() + myPos;
+    char *anEnd = nullptr;
+
+    theValue.myKind = Report_Json::Kind::Number;
+    theValue.myNumber = std::strtod(aBegin, &anEnd);
+
+    if (anEnd == aBegin)
+      return false;
+
+    myPos += anEnd - aBegin;
+
+    return true;
+  }
+
+  static void appendUtf8(std::string &theStr, unsigned long theCode) {
+    if (theCode < 0x80) {
+      theStr += static_cast<char>(theCode);
+    } else if (theCode < 0x800) {
+      theStr += static_cast<char>(0xC0 | (theCode >> 6));
+      theStr += static_cast<char>(0x80 | (theCode & 0x3F));
+    } else {
+      theStr += static_cast<char>(0xE0 | (theCode >> 12));
+      theStr += static_cast<char>(0x80 | ((theCode >> 6) & 0x3F));
+      theStr += static_cast<char>(0x80 | (theCode & 0x3F));
+    }
+  }
+
+  bool parseString(std::string &theStr) {
+    myPos++; // "
+
+    while (myPos < myText.size()) {
+      char aChar = myText[myPos++];
+
+      if (aChar == '"')
+        return true;
+
+      if (aChar != '\\') {
+        theStr += aChar;
+        continue;
+      }
+
+      if (myPos == myText.size())
+        return false;
+
+      switch (myText[myPos++]) {
+      case 'b':
+        theStr += '\b';
+        break;
+      case 'f':
+        theStr += '\f';
+        break;
+      case 'n':
+        theStr += '\n';
+        break;
+      case 'r':
+        theStr += '\r';
+        break;
+      case 't':
+        theStr += '\t';
+        break;
+      case 'u':
+        if (myPos + 4 > myText.size())
+          return false;
+
+        appendUtf8(theStr,
+                   std::strtoul(myText.substr(myPos, 4).c_str(), nullptr, 16));
+        myPos += 4;
+        break;
+      default: // " \ /
+        theStr += myText[myPos - 1];
+      }
+    }
+
+    return false;
+  }
+
+  bool parseArray(Report_Json &theValue) {
+    theValue.myKind = Report_Json::Kind::Array;
+    myPos++; // [
+    skipSpaces();
+
+    if (consume("]"))
+      return true;
+
+    do {
+      theValue.myItems.emplace_back();
+
+      if (!parseValue(theValue.myItems.back()))
+        return false;
+
+      skipSpaces();
+    } while (consume(","));
+
+    return consume("]");
+  }
+
+  bool parseObject(Report_Json &theValue) {
+    theValue.myKind = Report_Json::Kind::Object;
+    myPos++; // {
+    skipSpaces();
+
+    if (consume("}"))
+      return true;
+
+    do {
+      skipSpaces();
+      theValue.myKeys.emplace_back();
+      theValue.myItems.emplace_back();
+
+      if (myPos == myText.size() || myText[myPos] != '"' ||
+          !parseString(theValue.myKeys.back()))
+        return false;
+
+      skipSpaces();
+
+      if (!consume(":") || !parseValue(theValue.myItems.back()))
+        return false;
+
+      skipSpaces();
+    } while (consume(","));
+
+    return consume("}");
+  }
+
+  const std::string &myText;
+  std::size_t myPos;
+};
+
+const Report_Json &Report_Json::Find(const std::string &theKey) const {
+  static const Report_Json NONE{};
+
+  for (std::size_t i = 0; i < myKeys.size(); ++i) {
+    if (myKeys[i] == theKey)
+      return myItems[i];
+  }
+
+  return NONE;
+}
+
+bool Report_Json::Parse(const std::string &theText, Report_Json &theValue) {
+  theValue = Report_Json{};
+
+  return Report_JsonParser{theText}.Parse(theValue);
+}
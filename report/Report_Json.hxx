@@ -0,0 +1,38 @@
+#ifndef _LuaOCCT_Report_Json_HeaderFile
+#define _LuaOCCT_Report_Json_HeaderFile
+
+#include <string>
+#include <vector>
+
+/// Just enough JSON to read the clang time traces.
+class Report_Json {
+public:
+  enum class Kind { Null, Boolean, Number, String, Array, Object };
+
+  Kind GetKind() const { return myKind; }
+
+  bool IsNull() const { return myKind == Kind::Null; }
+
+  double AsNumber() const { return myNumber; }
+
+  const std::string &AsString() const { return myString; }
+
+  /// The elements of an array, or the values of an object.
+  const std::vector<Report_Json> &Items() const { return myItems; }
+
+  /// The member |theKey| of an object, a null value if none.
+  const Report_Json &Find(const std::string &theKey) const;
+
+  static bool Parse(const std::string &theText, Report_Json &theValue);
+
+private:
+  friend class Report_JsonParser;
+
+  Kind myKind = Kind::Null;
+  double myNumber = 0;
+  std::string myString{};
+  std::vector<std::string> myKeys{};
+  std::vector<Report_Json> myItems{};
+};
+
+#endif
@@ -0,0 +1,125 @@
+#include "Report_Ranges.hxx"
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+bool Report_Ranges::Load(const std::string &theFilePath) {
+  std::ifstream aStream{theFilePath};
+
+  if (!aStream) {
+    std::cerr << "Cannot read " << theFilePath << '\n';
+    return false;
+  }
+
+  std::string aLine{};
+
+  while (std::getline(aStream, aLine)) {
+    if (aLine.empty() || aLine[0] == '#')
+      continue;
+
+    std::istringstream aFields{aLine};
+    std::string aSource{};
+    Report_Range aRange{};
+
+    std::getline(aFields, aSource, '\t');
+    aFields >> aRange.first >> aRange.last;
+    aFields.ignore();
+    std::getline(aFields, aRange.cls, '\t');
+    std::getline(aFields, aRange.member);
+
+    myClasses[aRange.cls] = SourceModule(aSource);
+    myRanges[aSource].push_back(aRange);
+  }
+
+  return true;
+}
+
+const Report_Range *Report_Ranges::Find(const std::string &theSource,
+                                        std::size_t theLine) const {
+  auto it = myRanges.find(theSource);
+
+  if (it == myRanges.cend())
+    return nullptr;
+
+  const Report_Range *aFound = nullptr;
+
+  for (const auto &aRange : it->second) {
+    if (theLine < aRange.first || theLine > aRange.last)
+      continue;
+
+    if (aFound == nullptr ||
+        aRange.last - aRange.first < aFound->last - aFound->first)
+      aFound = &aRange;
+  }
+
+  return aFound;
+}
+
+const Report_Range *
+Report_Ranges::FindLocation(const std::string &theText) const {
+  for (const auto &[aSource, aRanges] : myRanges) {
+    std::size_t aPos = theText.find(aSource + ':');
+
+    while (aPos != std::string::npos) {
+      // Not a suffix of another file name.
+      bool isName = aPos == 0 || theText[aPos - 1] == '/' ||
+                    theText[aPos - 1] == '\\' || theText[aPos - 1] == ' ';
+
+      if (isName) {
+        std::size_t aLine = std::strtoul(
+            theText.c_str() + aPos + aSource.size() + 1, nullptr, 10);
+
+        if (const Report_Range *aRange = Find(aSource, aLine))
+          return aRange;
+      }
+
+      aPos = theText.find(aSource + ':', aPos + 1);
+    }
+  }
+
+  return nullptr;
+}
+
+std::string Report_Ranges::Module(const std::string &theClass) const {
+  auto it = myClasses.find(theClass);
+
+  return it == myClasses.cend() ? "" : it->second;
+}
+
+std::string Report_Ranges::SourceModule(const std::string &theSource) {
+  if (theSource.size() < 2 || theSource[0] != 'l')
+    return "";
+
+  return theSource.substr(1, theSource.find_first_of("_.") - 1);
+}
+
+std::string Report_Ranges::FindClass(const std::string &theText) const {
+  std::size_t aPos = 0;
+
+  while (aPos < theText.size()) {
+    if (!std::isalpha(static_cast<unsigned char>(theText[aPos])) &&
+        theText[aPos] != '_') {
+      aPos++;
+      continue;
+    }
+
+    std::size_t anEnd = aPos;
+
+    while (anEnd < theText.size() &&
+           (std::isalnum(static_cast<unsigned char>(theText[anEnd])) ||
+            theText[anEnd] == '_'))
+      anEnd++;
+
+    std::string aWord = theText.substr(aPos, anEnd - aPos);
+
+    if (myClasses.count(aWord))
+      return aWord;
+
+    aPos = anEnd;
+  }
+
+  return "";
+}
@@ -0,0 +1,43 @@
+#ifndef _LuaOCCT_Report_Ranges_HeaderFile
+#define _LuaOCCT_Report_Ranges_HeaderFile
+
+#include <map>
+#include <string>
+#include <vector>
+
+/// Lines of a generated source binding a class, or one of its members.
+struct Report_Range {
+  std::size_t first = 0;
+  std::size_t last = 0;
+  std::string cls{};
+  std::string member{};
+};
+
+/// The luaocct_ranges.tsv written by the binder.
+class Report_Ranges {
+public:
+  bool Load(const std::string &theFilePath);
+
+  /// The innermost range of |theSource| holding |theLine|, null if none.
+  const Report_Range *Find(const std::string &theSource,
+                           std::size_t theLine) const;
+
+  /// The innermost range of a `source:line` spelled in |theText|, e.g. by
+  /// `(lambda at /path/lGeom.cpp:12:34)`, null if none.
+  const Report_Range *FindLocation(const std::string &theText) const;
+
+  /// The first bound class named in |theText|, empty if none.
+  std::string FindClass(const std::string &theText) const;
+
+  /// The module binding |theClass|, empty if none.
+  std::string Module(const std::string &theClass) const;
+
+  /// The module of a generated source, e.g. `Geom` of `lGeom_2.cpp`.
+  static std::string SourceModule(const std::string &theSource);
+
+private:
+  std::map<std::string, std::vector<Report_Range>> myRanges{};
+  std::map<std::string, std::string> myClasses{};
+};
+
+#endif
@@ -0,0 +1,275 @@
+#include "Report_Size.hxx"
+#include "Report_Util.hxx"
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#if defined(__GNUC__) || defined(__clang__)
+#include <cxxabi.h>
+#endif
+
+#if defined(_WIN32)
+#define popen _popen
+#define pclose _pclose
+#endif
+
+namespace {
+
+struct Symbol {
+  double size = 0;
+  std::string name{};
+  std::string location{}; // `file:line`, or the object file
+};
+
+} // namespace
+
+static std::string demangle(const std::string &theName) {
+#if defined(__GNUC__) || defined(__clang__)
+  int aStatus = 0;
+  char *aName =
+      abi::__cxa_demangle(theName.c_str(), nullptr, nullptr, &aStatus);
+
+  if (aStatus == 0 && aName != nullptr) {
+    std::string aResult = aName;
+    std::free(aName);
+    return aResult;
+  }
+#endif
+
+  return theName;
+}
+
+/// `nm -C -S --size-sort -l`, i.e. `address size type name[\tfile:line]`.
+static void readNm(std::istream &theStream, std::vector<Symbol> &theSymbols) {
+  // Code, weak template instances and data, not bss.
+  static const std::string TYPES = "TtWwVvDdRr";
+  std::string aLine{};
+
+  while (std::getline(theStream, aLine)) {
+    std::istringstream aFields{aLine};
+    std::string anAddress{};
+    std::string aSize{};
+    std::string aType{};
+
+    if (!(aFields >> anAddress >> aSize >> aType) || aType.size() != 1 ||
+        TYPES.find(aType[0]) == std::string::npos)
+      continue;
+
+    Symbol aSymbol{};
+    aSymbol.size =
+        static_cast<double>(std::strtoull(aSize.c_str(), nullptr, 16));
+    std::getline(aFields >> std::ws, aSymbol.name);
+
+    std::size_t aTab = aSymbol.name.rfind('\t');
+
+    if (aTab != std::string::npos) {
+      aSymbol.location = aSymbol.name.substr(aTab + 1);
+      aSymbol.name.resize(aTab);
+    }
+
+    theSymbols.push_back(aSymbol);
+  }
+}
+
+/// GNU ld -Map, built with -ffunction-sections -fdata-sections:
+/// ` .text.<symbol> address size object`, wrapped after long names.
+static void readMap(std::istream &theStream,
+                    std::vector<Symbol> &theSymbols) {
+  std::string aLine{};
+  std::string aSection{};
+
+  while (std::getline(theStream, aLine)) {
+    std::istringstream aFields{aLine};
+
+    if (Report_Util_StartsWith(aLine, " .")) {
+      aFields >> aSection;
+    } else if (aSection.empty() || aLine.empty() || aLine[0] != ' ') {
+      aSection.clear();
+      continue;
+    }
+
+    std::string anAddress{};
+    std::string aSize{};
+    Symbol aSymbol{};
+
+    // The address and size on the next line.
+    if (!(aFields >> anAddress >> aSize))
+      continue;
+
+    std::getline(aFields >> std::ws, aSymbol.location);
+
+    if (Report_Util_StartsWith(aSection, ".text") ||
+        Report_Util_StartsWith(aSection, ".rodata") ||
+        Report_Util_StartsWith(aSection, ".data")) {
+      std::size_t aDot = aSection.find('.', 1);
+
+      if (aDot != std::string::npos)
+        aSymbol.name = demangle(aSection.substr(aDot + 1));
+
+      aSymbol.size =
+          static_cast<double>(std::strtoull(aSize.c_str(), nullptr, 16));
+      theSymbols.push_back(aSymbol);
+    }
+
+    aSection.clear();
+  }
+}
+
+/// The template of a LuaBridge or lsupport.h instance named |theName|,
+/// without its arguments, e.g. `luabridge::Stack` of
+/// `luabridge::Stack<gp_Pnt>::push`. Empty for another symbol.
+static std::string templateOf(const std::string &theName) {
+  std::size_t aPos = std::string::npos;
+
+  for (const char *aPrefix : {"luabridge::", "luaocct::"}) {
+    // After the return type of a function template.
+    aPos = theName.find(aPrefix);
+
+    if (aPos != std::string::npos && (aPos == 0 || theName[aPos - 1] == ' '))
+      break;
+
+    aPos = std::string::npos;
+  }
+
+  if (aPos == std::string::npos)
+    return "";
+
+  std::size_t anEnd = theName.find_first_of("<(", aPos);
+  return theName.substr(aPos, anEnd == std::string::npos ? anEnd
+                                                         : anEnd - aPos);
+}
+
+static bool readSymbols(const std::string &theInput,
+                        std::vector<Symbol> &theSymbols) {
+  std::ifstream aStream{theInput, std::ios::binary};
+
+  if (!aStream) {
+    std::cerr << "Cannot read " << theInput << '\n';
+    return false;
+  }
+
+  std::ostringstream aText{};
+  aText << aStream.rdbuf();
+  std::string aContent = aText.str();
+
+  if (Report_Util_StartsWith(aContent, "\177ELF")) {
+    std::string aCommand = "nm -C -S --size-sort -l \"" + theInput + '"';
+    FILE *aPipe = popen(aCommand.c_str(), "r");
+
+    if (aPipe == nullptr) {
+      std::cerr << "Cannot run " << aCommand << '\n';
+      return false;
+    }
+
+    std::ostringstream anOutput{};
+    char aBuffer[4096];
+    std::size_t aRead = 0;
+
+    while ((aRead = std::fread(aBuffer, 1, sizeof(aBuffer), aPipe)) > 0)
+      anOutput.write(aBuffer, static_cast<std::streamsize>(aRead));
+
+    pclose(aPipe);
+    aContent = anOutput.str();
+  }
+
+  std::istringstream anInput{aContent};
+
+  if (aContent.find("Linker script and memory map") != std::string::npos)
+    readMap(anInput, theSymbols);
+  else
+    readNm(anInput, theSymbols);
+
+  return true;
+}
+
+bool Report_Size(const Report_Ranges &theRanges, const std::string &theInput,
+                 std::size_t theTop) {
+  std::vector<Symbol> aSymbols{};
+
+  if (!readSymbols(theInput, aSymbols))
+    return false;
+
+  std::map<std::string, double> aModules{};
+  std::map<std::string, double> aClasses{};
+  std::map<std::string, double> aMembers{};
+  std::map<std::string, double> aTemplates{};
+  std::map<std::string, double> aHelpers{};
+  double aTotal = 0;
+  double aNoMember = 0;
+
+  for (const auto &aSymbol : aSymbols) {
+    std::string aFile =
+        aSymbol.location.substr(0, aSymbol.location.rfind(':'));
+    std::string aSource = std::filesystem::path(aFile).filename().string();
+    const Report_Range *aRange = nullptr;
+
+    // lGeom.cpp:123 of the debug info, or lGeom.cpp.o of a map.
+    if (aFile.size() < aSymbol.location.size())
+      aRange = theRanges.Find(
+          aSource,
+          std::strtoul(aSymbol.location.c_str() + aFile.size() + 1, nullptr,
+                       10));
+    else if (std::filesystem::path(aSource).extension() == ".o" ||
+             std::filesystem::path(aSource).extension() == ".obj")
+      aSource = std::filesystem::path(aSource).stem().string();
+
+    if (aRange == nullptr)
+      aRange = theRanges.FindLocation(aSymbol.name);
+
+    std::string aClass =
+        aRange != nullptr ? aRange->cls : theRanges.FindClass(aSymbol.name);
+    std::string aModule = !aClass.empty()
+                              ? theRanges.Module(aClass)
+                              : Report_Ranges::SourceModule(aSource);
+
+    aTotal += aSymbol.size;
+    aModules[aModule.empty() ? "(other)" : aModule] += aSymbol.size;
+    aClasses[aClass.empty() ? "(other)" : aClass] += aSymbol.size;
+
+    std::string aTemplate = templateOf(aSymbol.name);
+
+    if (!aTemplate.empty())
+      aTemplates[aTemplate] += aSymbol.size;
+
+    if (Report_Util_StartsWith(aTemplate, "luaocct::"))
+      aHelpers[aModule.empty() ? "(other)" : aModule] += aSymbol.size;
+
+    if (aRange != nullptr && !aRange->member.empty())
+      aMembers[aClass + "::" + aRange->member] += aSymbol.size;
+    else
+      aNoMember += aSymbol.size;
+  }
+
+  if (aTotal <= 0) {
+    std::cerr << "No symbol size in " << theInput << '\n';
+    return false;
+  }
+
+  std::cout << "Size of " << aSymbols.size() << " symbols: " << std::fixed
+            << std::setprecision(1) << aTotal / 1024 << " KiB\n\n";
+  Report_Util_Print("By module:", aModules, aTotal, theTop, 1024, "KiB");
+  Report_Util_Print("By class:", aClasses, aTotal, theTop, 1024, "KiB");
+  Report_Util_Print("By member:", aMembers, aTotal, theTop, 1024, "KiB");
+  // e.g. of the explicit instances in linstances.cpp, with and without.
+  Report_Util_Print("By template:", aTemplates, aTotal, theTop, 1024, "KiB");
+  // The instances of lsupport.h, e.g. op_add, against the lambdas they
+  // replace in a build of an older generator.
+  Report_Util_Print("Shared helpers by module:", aHelpers, aTotal, theTop,
+                    1024, "KiB");
+
+  // The generated sources carry no marker per member: an instance of a
+  // template is located in its header, e.g. of LuaBridge, and is found at
+  // most by the class in its name.
+  std::cout << "Not attributed to a member: " << std::setprecision(1)
+            << aNoMember / 1024 << " KiB (" << 100 * aNoMember / aTotal
+            << "%), mostly template instances located in their headers\n";
+
+  return true;
+}
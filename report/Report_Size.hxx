@@ -0,0 +1,16 @@
+#ifndef _LuaOCCT_Report_Size_HeaderFile
+#define _LuaOCCT_Report_Size_HeaderFile
+
+#include "Report_Ranges.hxx"
+
+#include <string>
+
+/// Ranks the bound classes, members and modules by code size, from
+/// |theInput|: a binary read with nm, an `nm -C -S -l` listing or a GNU ld
+/// map file. A member is known only from the line of a symbol in a binding,
+/// not for the template instances located in their headers, ranked by
+/// template instead, and by module for the shared helpers of lsupport.h.
+bool Report_Size(const Report_Ranges &theRanges, const std::string &theInput,
+                 std::size_t theTop);
+
+#endif
@@ -0,0 +1,170 @@
+#include "Report_Time.hxx"
+#include "Report_Json.hxx"
+#include "Report_Util.hxx"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+struct Event {
+  double ts = 0;
+  double dur = 0;
+  double self = 0;
+  std::string name{};
+  std::string cls{};
+  std::string member{};
+};
+
+} // namespace
+
+/// Attributes |theEvent| from its source location or its detail, e.g. the
+/// template instantiated.
+static void attribute(const Report_Ranges &theRanges,
+                      const std::string &theSource, const Report_Json &theArgs,
+                      Event &theEvent) {
+  const std::string &aDetail = theArgs.Find("detail").AsString();
+  const Report_Json &aFile = theArgs.Find("file");
+  const Report_Range *aRange = nullptr;
+
+  if (!aFile.IsNull() &&
+      std::filesystem::path(aFile.AsString()).filename() == theSource)
+    aRange = theRanges.Find(
+        theSource, static_cast<std::size_t>(theArgs.Find("line").AsNumber()));
+
+  if (aRange == nullptr)
+    aRange = theRanges.FindLocation(aDetail);
+
+  if (aRange != nullptr) {
+    theEvent.cls = aRange->cls;
+    theEvent.member = aRange->member;
+    return;
+  }
+
+  theEvent.cls = theRanges.FindClass(aDetail);
+
+  if (theEvent.cls.empty() && theEvent.name == "Source")
+    theEvent.cls = "(headers)";
+}
+
+/// Adds the self time of the events of |theTrace| to |theClasses|,
+/// |theMembers| and |theSources|, in microseconds.
+static bool aggregate(const Report_Ranges &theRanges,
+                      const std::filesystem::path &theTrace,
+                      std::map<std::string, double> &theClasses,
+                      std::map<std::string, double> &theMembers,
+                      std::map<std::string, double> &theSources) {
+  std::ifstream aStream{theTrace};
+  std::ostringstream aText{};
+  aText << aStream.rdbuf();
+
+  Report_Json aRoot{};
+
+  if (!Report_Json::Parse(aText.str(), aRoot)) {
+    std::cerr << "Cannot parse " << theTrace.string() << '\n';
+    return false;
+  }
+
+  // lGeom.cpp.json, next to lGeom.cpp.o
+  std::string aSource = theTrace.stem().string();
+
+  std::map<double, std::vector<Event>> aThreads{};
+
+  for (const auto &anItem : aRoot.Find("traceEvents").Items()) {
+    Event anEvent{};
+    anEvent.name = anItem.Find("name").AsString();
+
+    // The "Total ..." events sum up the others.
+    if (anItem.Find("ph").AsString() != "X" ||
+        anEvent.name.rfind("Total ", 0) == 0)
+      continue;
+
+    anEvent.ts = anItem.Find("ts").AsNumber();
+    anEvent.dur = anItem.Find("dur").AsNumber();
+    anEvent.self = anEvent.dur;
+    attribute(theRanges, aSource, anItem.Find("args"), anEvent);
+    aThreads[anItem.Find("tid").AsNumber()].push_back(anEvent);
+  }
+
+  for (auto &[aTid, anEvents] : aThreads) {
+    // Parents first.
+    std::sort(anEvents.begin(), anEvents.end(),
+              [](const Event &theA, const Event &theB) {
+                return theA.ts < theB.ts ||
+                       (theA.ts == theB.ts && theA.dur > theB.dur);
+              });
+
+    std::vector<Event *> aStack{};
+
+    for (auto &anEvent : anEvents) {
+      while (!aStack.empty() &&
+             aStack.back()->ts + aStack.back()->dur <= anEvent.ts)
+        aStack.pop_back();
+
+      if (!aStack.empty()) {
+        aStack.back()->self -= anEvent.dur;
+
+        // Nested in a bound class, e.g. the instantiations of its wrappers.
+        if (anEvent.cls.empty()) {
+          anEvent.cls = aStack.back()->cls;
+          anEvent.member = aStack.back()->member;
+        }
+      }
+
+      aStack.push_back(&anEvent);
+    }
+
+    for (const auto &anEvent : anEvents) {
+      std::string aClass = anEvent.cls.empty() ? "(other)" : anEvent.cls;
+      theClasses[aClass] += anEvent.self;
+      theSources[aSource] += anEvent.self;
+
+      if (!anEvent.member.empty())
+        theMembers[aClass + "::" + anEvent.member] += anEvent.self;
+    }
+  }
+
+  return true;
+}
+
+bool Report_Time(const Report_Ranges &theRanges,
+                 const std::string &theTraceDir, std::size_t theTop) {
+  std::map<std::string, double> aClasses{};
+  std::map<std::string, double> aMembers{};
+  std::map<std::string, double> aSources{};
+  int aNbTraces = 0;
+
+  for (const auto &anEntry :
+       std::filesystem::recursive_directory_iterator(theTraceDir)) {
+    if (anEntry.path().extension() != ".json")
+      continue;
+
+    if (aggregate(theRanges, anEntry.path(), aClasses, aMembers, aSources))
+      aNbTraces++;
+  }
+
+  double aTotal = 0;
+
+  for (const auto &[aClass, aCost] : aClasses)
+    aTotal += aCost;
+
+  if (aTotal <= 0) {
+    std::cerr << "No time trace under " << theTraceDir << '\n';
+    return false;
+  }
+
+  std::cout << "Compile time of " << aNbTraces << " sources: " << std::fixed
+            << std::setprecision(1) << aTotal / 1000 << " ms\n\n";
+  Report_Util_Print("By class:", aClasses, aTotal, theTop, 1000, "ms");
+  Report_Util_Print("By member:", aMembers, aTotal, theTop, 1000, "ms");
+  // e.g. the precompiled header, then each module source once it is used.
+  Report_Util_Print("By source:", aSources, aTotal, theTop, 1000, "ms");
+
+  return true;
+}
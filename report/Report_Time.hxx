@@ -0,0 +1,13 @@
+#ifndef _LuaOCCT_Report_Time_HeaderFile
+#define _LuaOCCT_Report_Time_HeaderFile
+
+#include "Report_Ranges.hxx"
+
+#include <string>
+
+/// Ranks the bound classes and members by the compile time spent on them,
+/// from the clang -ftime-trace files found under |theTraceDir|.
+bool Report_Time(const Report_Ranges &theRanges,
+                 const std::string &theTraceDir, std::size_t theTop);
+
+#endif
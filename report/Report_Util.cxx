@@ -0,0 +1,29 @@
+#include "Report_Util.hxx"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+void Report_Util_Print(const std::string &theTitle,
+                       const std::map<std::string, double> &theCosts,
+                       double theTotal, std::size_t theTop, double theScale,
+                       const std::string &theUnit) {
+  std::vector<std::pair<std::string, double>> aRanked{theCosts.cbegin(),
+                                                      theCosts.cend()};
+  std::sort(aRanked.begin(), aRanked.end(),
+            [](const auto &theA, const auto &theB) {
+              return theA.second > theB.second;
+            });
+
+  std::cout << theTitle << '\n';
+
+  for (std::size_t i = 0; i < aRanked.size() && i < theTop; ++i) {
+    std::cout << std::setw(12) << std::fixed << std::setprecision(1)
+              << aRanked[i].second / theScale << ' ' << theUnit << ' '
+              << std::setw(5) << aRanked[i].second * 100 / theTotal << "%  "
+              << aRanked[i].first << '\n';
+  }
+
+  std::cout << std::endl;
+}
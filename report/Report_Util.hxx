@@ -0,0 +1,19 @@
+#ifndef _LuaOCCT_Report_Util_HeaderFile
+#define _LuaOCCT_Report_Util_HeaderFile
+
+#include <map>
+#include <string>
+
+inline bool Report_Util_StartsWith(const std::string &theStr,
+                                   const std::string &thePrefix) {
+  return theStr.rfind(thePrefix, 0) == 0;
+}
+
+/// Prints the |theTop| highest |theCosts| with their share of |theTotal|,
+/// divided by |theScale| in |theUnit|.
+void Report_Util_Print(const std::string &theTitle,
+                       const std::map<std::string, double> &theCosts,
+                       double theTotal, std::size_t theTop, double theScale,
+                       const std::string &theUnit);
+
+#endif
@@ -46,6 +46,12 @@ int main(int argc, char const *argv[]) {
   }
 
   binder_config.Init(argv[4]);
+
+  // The bound classes of every module are known before the first one is
+  // generated, e.g. to emplace a result or keep a static base as a class.
+  if (!aGenerator.Index()) {
+    return 3;
+  }
   aGenerator.GenerateEnumsBegin();
 
   for (const std::string &aModName : binder_config.myModules) {
@@ -63,6 +69,12 @@ int main(int argc, char const *argv[]) {
 
   aGenerator.GenerateEnumsEnd();
   aGenerator.GenerateMain();
+  aGenerator.GenerateBench();
+  aGenerator.GenerateInstances();
+  aGenerator.GenerateClassIds();
+  aGenerator.GeneratePch();
+  aGenerator.GenerateReport();
+  aGenerator.GenerateSupport();
 
   return 0;
 }
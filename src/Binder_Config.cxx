@@ -75,6 +75,27 @@ bool Binder_Config::loadStringMap(
   return false;
 }
 
+bool Binder_Config::loadIntMap(
+    const toml::v3::node_view<toml::v3::node> &theNode,
+    std::unordered_map<std::string, int> &theIntMap) {
+  if (toml::table *tbl = theNode.as_table()) {
+    theIntMap.clear();
+
+    for (auto it = tbl->cbegin(); it != tbl->cend(); ++it) {
+      std::string key = it->first.data();
+      if (it->second.is_integer()) {
+        std::optional<int> v = it->second.value<int>();
+        if (v.has_value())
+          theIntMap[key] = v.value();
+      }
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
 bool Binder_Config::load() {
   if (!loadStringVec(myToml["modules"], myModules))
     return false;
@@ -110,5 +131,15 @@ bool Binder_Config::load() {
   if (!loadStringMap(myToml["manual_method"], myManualMethod))
     return false;
 
+  // Optional.
+  loadIntMap(myToml["shards"], myShards);
+  myPlugins = myToml["plugins"].value_or(false);
+  myLazyModules = myToml["lazy_modules"].value_or(false);
+  myLazyClasses = myToml["lazy_classes"].value_or(false);
+  myFlattenMethods = myToml["flatten_methods"].value_or(false);
+  myUsageScripts = myToml["usage_scripts"].value_or(std::string{});
+  myPruneSignatures = myToml["prune_signatures"].value_or(false);
+  myExplicitInstances = myToml["explicit_instances"].value_or(true);
+
   return true;
 }
@@ -20,6 +20,14 @@ struct Binder_Config {
   std::set<std::string> myBlackListCopyable{};
   std::unordered_map<std::string, std::string> myExtraMethod{};
   std::unordered_map<std::string, std::string> myManualMethod{};
+  std::unordered_map<std::string, int> myShards{};
+  bool myPlugins = false;
+  bool myLazyModules = false;
+  bool myLazyClasses = false;
+  bool myFlattenMethods = false;
+  std::string myUsageScripts{};
+  bool myPruneSignatures = false;
+  bool myExplicitInstances = true;
 
   Binder_Config();
 
@@ -39,6 +47,9 @@ private:
   static bool
   loadStringMap(const toml::v3::node_view<toml::v3::node> &theNode,
                 std::unordered_map<std::string, std::string> &theStringMap);
+
+  static bool loadIntMap(const toml::v3::node_view<toml::v3::node> &theNode,
+                         std::unordered_map<std::string, int> &theIntMap);
 };
 
 #endif
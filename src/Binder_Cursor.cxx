@@ -21,6 +21,17 @@ std::string Binder_Cursor::DisplayName() const {
   return Binder_Util_GetCString(clang_getCursorDisplayName(myCursor));
 }
 
+std::string Binder_Cursor::File() const {
+  CXFile aFile = nullptr;
+  clang_getExpansionLocation(clang_getCursorLocation(myCursor), &aFile,
+                             nullptr, nullptr, nullptr);
+
+  if (aFile == nullptr)
+    return "";
+
+  return Binder_Util_GetCString(clang_getFileName(aFile));
+}
+
 bool Binder_Cursor::IsTransient() const {
   if (Spelling() == "Standard_Transient")
     return true;
@@ -307,3 +318,22 @@ bool Binder_Cursor::IsCopyable() const {
 
   return !hasMoveCtor;
 }
+
+long long Binder_Cursor::EnumConstValue() const {
+  Binder_Type anIntType = clang_getEnumDeclIntegerType(Parent());
+
+  switch (anIntType.GetCanonical().Kind()) {
+  case CXType_Bool:
+  case CXType_Char_U:
+  case CXType_UChar:
+  case CXType_UShort:
+  case CXType_UInt:
+  case CXType_ULong:
+  case CXType_ULongLong:
+    // Wrapped above LLONG_MAX, as by the cast to lua_Integer.
+    return static_cast<long long>(
+        clang_getEnumConstantDeclUnsignedValue(myCursor));
+  default:
+    return clang_getEnumConstantDeclValue(myCursor);
+  }
+}
@@ -31,6 +31,8 @@ public:
 
   std::string DisplayName() const;
 
+  std::string File() const;
+
   bool NoDecl() const { return Kind() == CXCursor_NoDeclFound; }
 
   bool IsNull() const { return clang_Cursor_isNull(myCursor) || NoDecl(); }
@@ -186,6 +188,9 @@ public:
     return GetChildrenOfKind(CXCursor_EnumConstantDecl);
   }
 
+  /// The value of an enum constant, as the lua_Integer it is pushed as.
+  long long EnumConstValue() const;
+
   bool NeedsInOutMethod() const;
 
   void GetInOutParams(std::vector<Binder_Cursor> &theIn,
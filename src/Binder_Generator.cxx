@@ -1,9 +1,12 @@
 ﻿#include "Binder_Generator.hxx"
 #include "Binder_Module.hxx"
+#include "Binder_Support.hxx"
 #include "Binder_Util.hxx"
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <sstream>
 
 extern Binder_Config binder_config;
 
@@ -22,7 +25,45 @@ bool Binder_Generator::AddVisitedClass(const std::string &theClass) {
 
 #define MOD_CALL(F) myCurMod ? (myCurMod->F) : false
 
-bool Binder_Generator::Parse() { return MOD_CALL(Parse()); }
+bool Binder_Generator::Parse() {
+  // Saved by Index(), a module is loaded instead of parsed again.
+  auto aUnit = myCurMod ? myIndexedUnits.find(myCurMod->Name())
+                        : myIndexedUnits.end();
+
+  if (aUnit != myIndexedUnits.end()) {
+    bool isLoaded = myCurMod->Load(aUnit->second);
+    std::filesystem::remove(aUnit->second);
+    myIndexedUnits.erase(aUnit);
+
+    if (isLoaded)
+      return true;
+  }
+
+  return MOD_CALL(Parse());
+}
+
+bool Binder_Generator::Index() {
+  for (const std::string &aModName : binder_config.myModules) {
+    Binder_Module aMod{aModName, *this};
+
+    if (!aMod.Parse() || !aMod.Index(myClassIndex))
+      return false;
+
+    std::string aUnit = (std::filesystem::temp_directory_path() /
+                         ("luaocct_" + aModName + ".ast"))
+                            .string();
+
+    if (aMod.Save(aUnit) == CXSaveError_None)
+      myIndexedUnits[aModName] = aUnit;
+  }
+
+  std::cout << "Indexed: " << myClassIndex.NbClasses() << " classes\n";
+
+  if (!binder_config.myUsageScripts.empty())
+    return myClassIndex.Reach(binder_config.myUsageScripts);
+
+  return true;
+}
 
 bool Binder_Generator::Generate() {
   if (!myCurMod->Init())
@@ -59,7 +100,14 @@ bool Binder_Generator::GenerateEnumsBegin() {
 bool Binder_Generator::GenerateEnumsEnd() {
   std::string thePath = myExportDir + "/lenums.h";
 
+  // Generated sources include the enum headers they need, this one is kept
+  // for hand-written code.
   std::ofstream aStream{thePath, std::ios::app};
+
+  for (const auto &aMod : binder_config.myModules) {
+    aStream << "#include \"lenums_" << aMod << ".h\"\n";
+  }
+
   aStream << "\n#endif\n";
 
   return true;
@@ -70,9 +118,14 @@ bool Binder_Generator::GenerateMain() {
 
   // The header file.
   std::ofstream aStream{thePath};
+  bool isLazy = binder_config.myLazyModules && !binder_config.myPlugins;
+
   aStream << "/* This file is generated, do not edit. */\n\n";
   aStream << "#include <luaocct/luaocct.h>\n\n";
 
+  if (isLazy)
+    aStream << "#include \"llazy.h\"\n\n";
+
   for (const auto &aMod : binder_config.myModules) {
     aStream << "extern void luaocct_init_" << aMod << "(lua_State *L);\n";
   }
@@ -81,19 +134,489 @@ bool Binder_Generator::GenerateMain() {
     aStream << "extern void luaocct_init_" << aMod << "(lua_State *L);\n";
   }
 
+  if (isLazy) {
+    aStream << '\n';
+
+    // Only a base orders the registration, a module only used comes after.
+    for (const auto &aMod : binder_config.myModules) {
+      aStream << "static const char *const BASES_" << aMod << "[] = {";
+
+      for (const auto &aDep : binder_config.myModules) {
+        if (Binder_Util_Contains(myBaseDependencies[aMod], aDep))
+          aStream << '"' << aDep << "\", ";
+      }
+
+      aStream << "nullptr};\n";
+      aStream << "static const char *const USES_" << aMod << "[] = {";
+
+      for (const auto &aDep : binder_config.myModules) {
+        if (Binder_Util_Contains(myDependencies[aMod], aDep) &&
+            !Binder_Util_Contains(myBaseDependencies[aMod], aDep))
+          aStream << '"' << aDep << "\", ";
+      }
+
+      aStream << "nullptr};\n";
+    }
+
+    aStream << "\nstatic const luaocct::lazy_entry MODULES[] = {\n";
+
+    for (const auto &aMod : binder_config.myModules) {
+      aStream << "\t{\"" << aMod << "\", &luaocct_init_" << aMod << ", BASES_"
+              << aMod << ", USES_" << aMod << "},\n";
+    }
+
+    aStream << "\t{nullptr, nullptr, nullptr, nullptr},\n};\n";
+  }
+
   aStream << "\nint luaopen_luaocct(lua_State *L) {\n";
 
+  // The plugins register their module on require.
   for (const auto &aMod : binder_config.myModules) {
-    aStream << "\tluaocct_init_" << aMod << "(L);\n";
+    if (!binder_config.myPlugins && !isLazy)
+      aStream << "\tluaocct_init_" << aMod << "(L);\n";
   }
 
   for (const auto &aMod : binder_config.myExtraModules) {
     aStream << "\tluaocct_init_" << aMod << "(L);\n";
   }
 
+  if (isLazy)
+    aStream << "\tluaocct::lazy_install(L, MODULES);\n";
+
   aStream << "\n\treturn 0;\n}\n";
   std::cout << "Exported: " << thePath << '\n' << std::endl;
 
+  if (binder_config.myPlugins)
+    return GeneratePlugins();
+
+  return true;
+}
+
+bool Binder_Generator::GeneratePlugins() {
+  std::ofstream{myExportDir + "/lplugin.h"} << Binder_Support_Plugin;
+
+  for (const auto &aMod : binder_config.myModules) {
+    std::string thePath = myExportDir + "/lplugin_" + aMod + ".cpp";
+    const auto &aBases = myForeignBases[aMod];
+
+    std::ofstream aStream{thePath};
+    aStream << "/* This file is generated, do not edit. */\n\n";
+    aStream << "#include <luaocct_bind/lbind.h>\n\n";
+
+    std::set<std::string> anIncludes{};
+
+    for (const auto &[aBase, anInclude] : aBases) {
+      if (!anInclude.empty())
+        anIncludes.insert(anInclude);
+    }
+
+    for (const auto &anInclude : anIncludes) {
+      aStream << "#include <" << anInclude << ">\n";
+    }
+
+    // The registry keys of the bases, of the core.
+    aStream << "\n#include \"linstances.h\"\n#include \"lplugin.h\"\n\n";
+    aStream << "extern void luaocct_init_" << aMod << "(lua_State *L);\n\n";
+    aStream << "LUAOCCT_PLUGIN_EXPORT int luaopen_luaocct_" << aMod
+            << "(lua_State *L) {\n";
+
+    // In the order of the modules, the bases are registered first. A later
+    // module would require back the modules in progress.
+    for (const auto &aDep : binder_config.myModules) {
+      if (aDep == aMod)
+        break;
+
+      if (Binder_Util_Contains(myDependencies[aMod], aDep))
+        aStream << "\tluaocct::require(L, \"luaocct." << aDep << "\");\n";
+    }
+
+    for (const auto &[aBase, anInclude] : aBases) {
+      aStream << "\tluaocct::check_base<" << aBase << ">(L, \"" << aBase
+              << "\");\n";
+    }
+
+    aStream << "\n\tluaocct_init_" << aMod << "(L);\n";
+    aStream << "\treturn luaocct::module_table(L, \"" << aMod << "\");\n}\n";
+  }
+
+  std::ofstream aCMake{myExportDir + "/luaocct_plugins.cmake"};
+  aCMake << "# This file is generated, do not edit.\n\n";
+  aCMake << "set(LUAOCCT_PLUGIN_DIR \"${CMAKE_CURRENT_LIST_DIR}\")\n";
+  aCMake << "set(LUAOCCT_PLUGINS";
+
+  for (const auto &aMod : binder_config.myModules) {
+    aCMake << ' ' << aMod;
+  }
+
+  aCMake << ")\n\n";
+
+  // lclasses.cpp defines the class ids of lsupport.h, linstances.cpp the
+  // registry keys, the plugins use them.
+  aCMake << "# The sources of the core, a shared library the plugins link "
+            "to.\n";
+  aCMake << "set(LUAOCCT_CORE_SOURCES\n";
+
+  for (const char *aSource : {"luaocct", "linstances", "lclasses"})
+    aCMake << "  \"${LUAOCCT_PLUGIN_DIR}/" << aSource << ".cpp\"\n";
+
+  aCMake << ")\n\n";
+  aCMake << "# Adds the Lua C module luaocct/<Mod> of each module, linked to "
+            "theCore, the\n";
+  aCMake << "# shared library of LUAOCCT_CORE_SOURCES, and to the other "
+            "arguments.\n";
+  aCMake << "#\n";
+  aCMake << "# The modules share the LuaBridge classes through the registry "
+            "keys and the\n";
+  aCMake << "# class ids, defined by linstances.cpp and lclasses.cpp of "
+            "theCore only, so\n";
+  aCMake << "# theCore must be a SHARED library, and export them.\n";
+  aCMake << "function(luaocct_add_plugins theCore)\n";
+  aCMake << "  foreach(aMod ${LUAOCCT_PLUGINS})\n";
+  aCMake << "    file(GLOB aSrcs \"${LUAOCCT_PLUGIN_DIR}/l${aMod}.cpp\"\n";
+  aCMake << "      \"${LUAOCCT_PLUGIN_DIR}/l${aMod}_[0-9]*.cpp\")\n";
+  aCMake << "    add_library(luaocct_${aMod} MODULE ${aSrcs}\n";
+  aCMake << "      \"${LUAOCCT_PLUGIN_DIR}/lplugin_${aMod}.cpp\")\n";
+  aCMake << "    target_link_libraries(luaocct_${aMod} PRIVATE ${theCore} "
+            "${ARGN})\n";
+  aCMake << "    set_target_properties(luaocct_${aMod} PROPERTIES\n";
+  aCMake << "      PREFIX \"\" OUTPUT_NAME ${aMod}\n";
+  aCMake << "      LIBRARY_OUTPUT_DIRECTORY \"${CMAKE_BINARY_DIR}/luaocct\")\n";
+  aCMake << "  endforeach()\n";
+  aCMake << "endfunction()\n";
+
+  std::cout << "Exported: " << myExportDir << "/lplugin_*.cpp, "
+            << "luaocct_plugins.cmake\n";
+  std::cout << "Plugins: " << binder_config.myModules.size()
+            << " modules loaded on require(\"luaocct.<Mod>\")\n"
+            << std::endl;
+
+  return true;
+}
+
+bool Binder_Generator::GenerateBench() {
+  // The inits of the plugins are in their Lua C modules, not linked. With
+  // lazy_classes, an init only installs the __index of its module, the
+  // classes are registered on their first use. The files of a previous run
+  // would not build, or time nothing.
+  if (binder_config.myPlugins || binder_config.myLazyClasses) {
+    for (const char *aFile : {"lbench.cpp", "lbench.h", "luaocct_bench.cmake"})
+      std::filesystem::remove(myExportDir + '/' + aFile);
+
+    std::cout << "Bench: skipped with "
+              << (binder_config.myPlugins ? "plugins" : "lazy_classes")
+              << '\n'
+              << std::endl;
+    return true;
+  }
+
+  std::string thePath = myExportDir + "/lbench.cpp";
+  std::ofstream{myExportDir + "/lbench.h"} << Binder_Support_Bench;
+
+  std::ofstream aStream{thePath};
+  aStream << "/* This file is generated, do not edit. */\n\n";
+  aStream << "#include \"lbench.h\"\n\n";
+
+  std::vector<std::string> aMods = binder_config.myModules;
+  aMods.insert(aMods.end(), binder_config.myExtraModules.cbegin(),
+               binder_config.myExtraModules.cend());
+
+  for (const auto &aMod : aMods) {
+    aStream << "extern void luaocct_init_" << aMod << "(lua_State *L);\n";
+  }
+
+  // In the order of luaopen_luaocct.
+  aStream << "\nstatic const luaocct::bench_module MODULES[] = {\n";
+
+  for (const auto &aMod : aMods) {
+    aStream << "\t{\"" << aMod << "\", &luaocct_init_" << aMod << "},\n";
+  }
+
+  aStream << "\t{nullptr, nullptr},\n};\n\n";
+  aStream << "int main(int argc, char *argv[]) {\n";
+  aStream << "\treturn luaocct::bench_main(argc, argv, MODULES, "
+             "&luaopen_luaocct);\n";
+  aStream << "}\n";
+
+  std::ofstream aCMake{myExportDir + "/luaocct_bench.cmake"};
+  aCMake << "# This file is generated, do not edit.\n\n";
+  aCMake << "# Adds theTarget, timing luaopen_luaocct and the init of each "
+            "module of the\n";
+  aCMake << "# bindings linked from ARGN. Run `theTarget [runs] [--json]`.\n";
+  aCMake << "function(luaocct_add_bench theTarget)\n";
+  aCMake << "  add_executable(${theTarget} "
+            "\"${CMAKE_CURRENT_FUNCTION_LIST_DIR}/lbench.cpp\")\n";
+  aCMake << "  target_link_libraries(${theTarget} PRIVATE ${ARGN})\n";
+  aCMake << "endfunction()\n";
+
+  std::cout << "Exported: " << thePath << ", lbench.h, luaocct_bench.cmake\n"
+            << std::endl;
+
+  return true;
+}
+
+bool Binder_Generator::GenerateInstances() {
+  std::set<std::string> anIncludes{};
+  std::ostringstream anExterns{};
+  std::ostringstream aDefs{};
+  int aNbTypes = 0;
+
+  // Only the types shared by several modules are worth a single instance.
+  // Without, both files are still exported, empty, for the same build.
+  for (const auto &[aType, anInstance] : myInstances) {
+    if (!binder_config.myExplicitInstances || anInstance.modules.size() < 2)
+      continue;
+
+    // OCCT guards its headers with _<Name>_HeaderFile.
+    std::string aGuard =
+        '_' + std::filesystem::path(anInstance.include).stem().string() +
+        "_HeaderFile";
+
+    anIncludes.insert(anInstance.include);
+    anExterns << "#ifdef " << aGuard << '\n';
+    anExterns << "extern template struct luabridge::Stack<" << aType << ">;\n";
+    aDefs << "template struct luabridge::Stack<" << aType << ">;\n";
+
+    if (anInstance.isValue) {
+      anExterns << "extern template class luabridge::detail::UserdataValue<"
+                << aType << ">;\n";
+      aDefs << "template class luabridge::detail::UserdataValue<" << aType
+            << ">;\n";
+    }
+
+    anExterns << "#endif\n";
+    aNbTypes++;
+  }
+
+  // The plugins find the classes of one another by the addresses of inline
+  // statics. Defined here only, in their core library, they are one object
+  // even for modules loaded with RTLD_LOCAL.
+  for (const auto &[aClass, anInclude] : myClassKeys) {
+    if (!binder_config.myPlugins)
+      break;
+
+    std::string aGuard =
+        '_' + std::filesystem::path(anInclude).stem().string() +
+        "_HeaderFile";
+
+    anIncludes.insert(anInclude);
+    anExterns << "#ifdef " << aGuard << '\n';
+
+    for (const char *aKey : {"luabridge::detail::getClassRegistryKey",
+                             "luabridge::detail::getConstRegistryKey",
+                             "luabridge::detail::getStaticRegistryKey"}) {
+      anExterns << "extern template const void *" << aKey << '<' << aClass
+                << ">();\n";
+      aDefs << "template const void *" << aKey << '<' << aClass << ">();\n";
+    }
+
+    anExterns << "extern template int &luaocct::class_id<" << aClass
+              << ">();\n";
+    aDefs << "template int &luaocct::class_id<" << aClass << ">();\n";
+    anExterns << "#endif\n";
+  }
+
+  // Included last by the module sources, a type is declared only when its
+  // header has been included before.
+  std::ofstream aHeader{myExportDir + "/linstances.h"};
+  aHeader << "/* This file is generated, do not edit. */\n\n";
+  aHeader << "#ifndef _LuaOCCT_linstances_HeaderFile\n#define "
+             "_LuaOCCT_linstances_HeaderFile\n\n";
+  aHeader << "#include <luaocct_bind/lbind.h>\n\n";
+
+  if (binder_config.myPlugins)
+    aHeader << "#include \"lsupport.h\"\n\n";
+
+  aHeader << anExterns.str();
+  aHeader << "\n#endif\n";
+
+  std::string aPath = myExportDir + "/linstances.cpp";
+  std::ofstream aStream{aPath};
+  aStream << "/* This file is generated, do not edit. */\n\n";
+  aStream << "#include <luaocct_bind/lbind.h>\n\n";
+
+  for (const auto &anInclude : anIncludes) {
+    aStream << "#include <" << anInclude << ">\n";
+  }
+
+  aStream << "\n#include \"lenums.h\"\n#include \"linstances.h\"\n\n";
+  aStream << aDefs.str();
+
+  AddSource(aPath, anIncludes);
+
+  std::cout << "Exported: " << aPath << '\n';
+  std::cout << "Explicit instances: " << aNbTypes
+            << " classes shared by several modules, compare the By template "
+               "size report without explicit_instances\n";
+
+  if (binder_config.myPlugins)
+    std::cout << "Shared keys: " << myClassKeys.size()
+              << " classes, defined by the plugin core\n";
+
+  std::cout << std::endl;
+
+  return true;
+}
+
+bool Binder_Generator::GenerateClassIds() {
+  std::string aPath = myExportDir + "/lclasses.cpp";
+  std::ofstream aStream{aPath};
+  aStream << "/* This file is generated, do not edit. */\n\n";
+  aStream << "#include \"lsupport.h\"\n\n";
+  aStream << "namespace luaocct {\n\n";
+
+  // Cohen's displays: the ancestor of a class at depth d is display[d].
+  for (std::size_t i = 0; i < myDisplays.size(); ++i) {
+    aStream << "static const int DISPLAY_" << i << "[] = {"
+            << Binder_Util_Join(myDisplays[i].cbegin(), myDisplays[i].cend(),
+                                [](int theId) { return std::to_string(theId); })
+            << "};\n";
+  }
+
+  aStream << "\nextern const int *const class_displays[] = {\n";
+
+  for (std::size_t i = 0; i < myDisplays.size(); ++i)
+    aStream << "\tDISPLAY_" << i << ",\n";
+
+  aStream << "\tnullptr,\n};\n\nextern const int class_depths[] = {\n";
+
+  for (const auto &aDisplay : myDisplays)
+    aStream << '\t' << aDisplay.size() - 1 << ",\n";
+
+  aStream << "\t-1,\n};\n\n";
+  aStream << "extern const char class_id_tag = 0;\n\n} // namespace luaocct\n";
+
+  AddSource(aPath, {});
+
+  std::cout << "Exported: " << aPath << '\n';
+  std::cout << "Class ids: " << myDisplays.size() << " classes\n" << std::endl;
+
+  return true;
+}
+
+bool Binder_Generator::GeneratePch() {
+  std::string thePath = myExportDir + "/luaocct_pch.h";
+
+  std::ofstream aStream{thePath};
+  aStream << "/* This file is generated, do not edit. */\n\n";
+  aStream << "#ifndef _LuaOCCT_pch_HeaderFile\n#define "
+             "_LuaOCCT_pch_HeaderFile\n\n";
+  aStream << "#include <array>\n#include <sstream>\n#include <tuple>\n\n";
+  aStream << "#include <luaocct_bind/lbind.h>\n\n";
+
+  for (const auto &anInclude : myIncludes) {
+    aStream << "#include <" << anInclude << ">\n";
+  }
+
+  aStream << "\n#endif\n";
+
+  std::ofstream aCMake{myExportDir + "/luaocct_pch.cmake"};
+  aCMake << "# This file is generated, do not edit.\n\n";
+  aCMake << "set(LUAOCCT_PCH \"${CMAKE_CURRENT_LIST_DIR}/luaocct_pch.h\")\n\n";
+  aCMake << "option(LUAOCCT_USE_PCH \"Precompile luaocct_pch.h\" ON)\n\n";
+  aCMake << "# Precompiles luaocct_pch.h for theTarget, unless LUAOCCT_USE_PCH "
+            "is OFF. The\n";
+  aCMake << "# time report of luaocct_target_time_trace, built with and "
+            "without, gives the\n";
+  aCMake << "# compile time saved: its total, and its (headers) and By "
+            "source entries.\n";
+  aCMake << "function(luaocct_target_precompile_headers theTarget)\n";
+  aCMake << "  if(NOT LUAOCCT_USE_PCH)\n";
+  aCMake << "    return()\n";
+  aCMake << "  endif()\n\n";
+  aCMake << "  target_precompile_headers(${theTarget} PRIVATE "
+            "\"${LUAOCCT_PCH}\")\n";
+  aCMake << "endfunction()\n";
+
+  std::cout << "Exported: " << thePath << '\n';
+  std::cout << "Precompiled header: " << myIncludes.size()
+            << " OCCT headers included by " << mySources.size()
+            << " sources, timed by the time report with and without "
+               "LUAOCCT_USE_PCH\n"
+            << std::endl;
+
+  return true;
+}
+
+bool Binder_Generator::GenerateReport() {
+  std::string thePath = myExportDir + "/luaocct_ranges.tsv";
+
+  std::ofstream aStream{thePath};
+  aStream << "# source\tfirst\tlast\tclass\tmember\n";
+  aStream << myRanges.str();
+
+  if (binder_config.myPruneSignatures) {
+    std::ofstream aPruned{myExportDir + "/luaocct_pruned.tsv"};
+    aPruned << "# module\tclass\tmember\tunregistered type\n";
+    aPruned << myPruned.str();
+  }
+
+  std::ofstream aCMake{myExportDir + "/luaocct_report.cmake"};
+  aCMake << "# This file is generated, do not edit.\n\n";
+  aCMake << "include(CheckCXXCompilerFlag)\n\n";
+  aCMake << "set(LUAOCCT_RANGES \"${CMAKE_CURRENT_LIST_DIR}/"
+            "luaocct_ranges.tsv\")\n\n";
+  aCMake << "# Compiles theTarget with clang -ftime-trace, and adds "
+            "theTarget_time_report\n";
+  aCMake << "# ranking the bound classes by compile time with "
+            "luaocct-report. Without\n";
+  aCMake << "# -ftime-trace, e.g. GCC or MSVC, only a message is printed.\n";
+  aCMake << "function(luaocct_target_time_trace theTarget theReport)\n";
+  aCMake << "  check_cxx_compiler_flag(-ftime-trace LUAOCCT_HAS_TIME_TRACE)\n";
+  aCMake << "  if(NOT LUAOCCT_HAS_TIME_TRACE)\n";
+  aCMake << "    message(STATUS \"LuaOCCT: no -ftime-trace, \"\n";
+  aCMake << "      \"${theTarget}_time_report is not added\")\n";
+  aCMake << "    return()\n";
+  aCMake << "  endif()\n\n";
+  aCMake << "  target_compile_options(${theTarget} PRIVATE -ftime-trace\n"
+            "    -ftime-trace-granularity=0)\n\n";
+  aCMake << "  # Source locations of the events, clang 19 and later.\n";
+  aCMake << "  check_cxx_compiler_flag(-ftime-trace-verbose "
+            "LUAOCCT_HAS_TIME_TRACE_VERBOSE)\n";
+  aCMake << "  if(LUAOCCT_HAS_TIME_TRACE_VERBOSE)\n";
+  aCMake << "    target_compile_options(${theTarget} PRIVATE "
+            "-ftime-trace-verbose)\n";
+  aCMake << "  endif()\n\n";
+  aCMake << "  add_custom_target(\n";
+  aCMake << "    ${theTarget}_time_report\n";
+  aCMake << "    COMMAND ${theReport} time \"${LUAOCCT_RANGES}\"\n";
+  aCMake << "      \"${CMAKE_CURRENT_BINARY_DIR}/CMakeFiles/"
+            "${theTarget}.dir\"\n";
+  aCMake << "    DEPENDS ${theTarget}\n";
+  aCMake << "    VERBATIM)\n";
+  aCMake << "endfunction()\n\n";
+  aCMake << "# Adds theTarget_size_report, ranking the bound classes, members "
+            "and modules\n";
+  aCMake << "# by code size. The members need the debug info of -g.\n";
+  aCMake << "function(luaocct_target_size_report theTarget theReport)\n";
+  aCMake << "  add_custom_target(\n";
+  aCMake << "    ${theTarget}_size_report\n";
+  aCMake << "    COMMAND ${theReport} size \"${LUAOCCT_RANGES}\"\n";
+  aCMake << "      \"$<TARGET_FILE:${theTarget}>\"\n";
+  aCMake << "    DEPENDS ${theTarget}\n";
+  aCMake << "    VERBATIM)\n";
+  aCMake << "endfunction()\n";
+
+  std::cout << "Exported: " << thePath << ", luaocct_report.cmake\n"
+            << std::endl;
+
+  return true;
+}
+
+bool Binder_Generator::GenerateSupport() {
+  std::ofstream{myExportDir + "/lcollection.h"} << Binder_Support_Collection;
+  std::ofstream{myExportDir + "/lsupport.h"} << Binder_Support_Helpers;
+  std::ofstream{myExportDir + "/lenum.h"} << Binder_Support_Enum;
+  std::cout << "Exported: " << myExportDir
+            << "/lcollection.h, lsupport.h, lenum.h\n";
+
+  if ((binder_config.myLazyModules || binder_config.myLazyClasses) &&
+      !binder_config.myPlugins) {
+    std::ofstream{myExportDir + "/llazy.h"} << Binder_Support_Lazy;
+    std::cout << "Exported: " << myExportDir << "/llazy.h\n";
+  }
+
+  std::cout << std::endl;
+
   return true;
 }
 
@@ -101,6 +624,119 @@ bool Binder_Generator::IsClassVisited(const std::string &theClass) const {
   return Binder_Util_Contains(myVisitedClasses, theClass);
 }
 
+std::string Binder_Generator::IncludeName(const std::string &theFile) const {
+  if (theFile.empty())
+    return "";
+
+  std::error_code anErr{};
+  std::filesystem::path anInc =
+      std::filesystem::weakly_canonical(myOcctIncDir, anErr);
+  std::filesystem::path aFile =
+      std::filesystem::weakly_canonical(theFile, anErr);
+
+  if (anErr)
+    return "";
+
+  std::filesystem::path aRel = aFile.lexically_relative(anInc);
+
+  // Only OCCT headers, the module headers are for the generator.
+  if (aRel.empty() || Binder_Util_StartsWith(aRel.generic_string(), ".."))
+    return "";
+
+  return aRel.generic_string();
+}
+
+std::string Binder_Generator::FileModule(const std::string &theFile) const {
+  std::string anInclude = IncludeName(theFile);
+
+  if (anInclude.empty())
+    return "";
+
+  // OCCT names a header <Package>_<Name>.hxx, or <Package>.hxx.
+  std::string aStem = std::filesystem::path(anInclude).stem().string();
+  std::string aMod = aStem.substr(0, aStem.find('_'));
+
+  if (std::find(binder_config.myModules.cbegin(),
+                binder_config.myModules.cend(),
+                aMod) == binder_config.myModules.cend())
+    return "";
+
+  return aMod;
+}
+
+void Binder_Generator::AddSource(const std::string &thePath,
+                                 const std::set<std::string> &theIncludes) {
+  mySources.push_back(thePath);
+  myIncludes.insert(theIncludes.cbegin(), theIncludes.cend());
+}
+
+void Binder_Generator::AddInstance(const std::string &theType,
+                                   const std::string &theInclude,
+                                   const std::string &theModule,
+                                   bool theIsValue) {
+  Instance &anInstance = myInstances[theType];
+  anInstance.include = theInclude;
+  anInstance.isValue = theIsValue;
+  anInstance.modules.insert(theModule);
+}
+
+void Binder_Generator::AddClassKeys(const std::string &theClass,
+                                    const std::string &theInclude) {
+  myClassKeys[theClass] = theInclude;
+}
+
+void Binder_Generator::AddDependency(const std::string &theModule,
+                                     const std::string &theDependency,
+                                     bool isBase) {
+  myDependencies[theModule].insert(theDependency);
+
+  if (isBase)
+    myBaseDependencies[theModule].insert(theDependency);
+}
+
+void Binder_Generator::AddForeignBase(const std::string &theModule,
+                                      const std::string &theBase,
+                                      const std::string &theInclude) {
+  myForeignBases[theModule][theBase] = theInclude;
+}
+
+void Binder_Generator::AddPruned(const std::string &theModule,
+                                 const std::string &theClass,
+                                 const std::string &theMember,
+                                 const std::string &theType) {
+  myPruned << theModule << '\t' << theClass << '\t' << theMember << '\t'
+           << theType << '\n';
+}
+
+int Binder_Generator::AddClassId(const std::string &theClass,
+                                 const std::string &theBase) {
+  auto anIter = myClassIds.find(theClass);
+
+  if (anIter != myClassIds.end())
+    return anIter->second;
+
+  int anId = static_cast<int>(myDisplays.size());
+  std::vector<int> aDisplay{};
+  auto aBase = myClassIds.find(theBase);
+
+  if (aBase != myClassIds.end())
+    aDisplay = myDisplays[aBase->second];
+
+  aDisplay.push_back(anId);
+  myDisplays.push_back(std::move(aDisplay));
+  myClassIds[theClass] = anId;
+
+  return anId;
+}
+
+void Binder_Generator::AddRange(const std::string &theSource,
+                                std::size_t theFirst, std::size_t theLast,
+                                const std::string &theClass,
+                                const std::string &theMember) {
+  myRanges << theSource << '\t' << theFirst << '\t' << theLast << '\t'
+           << theClass << '\t' << theMember << '\n';
+}
+
 bool Binder_Generator::IsValid() const {
   if (!std::filesystem::is_directory(myModDir))
     return false;
@@ -5,12 +5,15 @@
 
 #include "Binder_Config.hxx"
 #include "Binder_Cursor.hxx"
+#include "Binder_Index.hxx"
 #include "Binder_Module.hxx"
 
 #include <filesystem>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -60,6 +63,8 @@ public:
 
   const std::shared_ptr<Binder_Module> &Module() const { return myCurMod; }
 
+  const Binder_Index &ClassIndex() const { return myClassIndex; }
+
   void SetModule(const std::shared_ptr<Binder_Module> &theModule) {
     myCurMod = theModule;
   }
@@ -68,8 +73,64 @@ public:
 
   bool IsClassVisited(const std::string &theClass) const;
 
+  /// Records that |theClass| is bound as a plain function table, which no
+  /// class can derive from.
+  void AddTableClass(const std::string &theClass) {
+    myTableClasses.insert(theClass);
+  }
+
+  bool IsTableClass(const std::string &theClass) const {
+    return myTableClasses.count(theClass) != 0;
+  }
+
+  std::string IncludeName(const std::string &theFile) const;
+
+  /// The bound module of the OCCT header |theFile|, i.e. its package, empty
+  /// if none.
+  std::string FileModule(const std::string &theFile) const;
+
+  void AddSource(const std::string &thePath,
+                 const std::set<std::string> &theIncludes);
+
+  /// Records that |theModule| uses luabridge::Stack<|theType>|, declared in
+  /// |theInclude|. |theIsValue| for the types pushed by copy.
+  void AddInstance(const std::string &theType, const std::string &theInclude,
+                   const std::string &theModule, bool theIsValue);
+
+  /// Records the bound class |theClass|, declared in |theInclude|, whose
+  /// registry keys and id the plugins share.
+  void AddClassKeys(const std::string &theClass,
+                    const std::string &theInclude);
+
+  /// Records that |theModule| uses the types of |theDependency|, or
+  /// derives from them if |isBase|.
+  void AddDependency(const std::string &theModule,
+                     const std::string &theDependency, bool isBase = false);
+
+  /// Records that |theModule| derives from |theBase| of another module.
+  void AddForeignBase(const std::string &theModule, const std::string &theBase,
+                      const std::string &theInclude);
+
+  /// Records that |theMember| of |theClass| was not bound, as |theType| is
+  /// registered nowhere.
+  void AddPruned(const std::string &theModule, const std::string &theClass,
+                 const std::string &theMember, const std::string &theType);
+
+  /// The dense id of |theClass|, derived from |theBase| if not empty. Ids
+  /// are given in registration order, a base before its derived classes.
+  int AddClassId(const std::string &theClass, const std::string &theBase);
+
+  /// Records that lines [|theFirst|, |theLast|] of |theSource| bind
+  /// |theMember| of |theClass|, the whole class if |theMember| is empty.
+  void AddRange(const std::string &theSource, std::size_t theFirst,
+                std::size_t theLast, const std::string &theClass,
+                const std::string &theMember);
+
   bool Parse();
 
+  /// Parses all the modules into the class index, before any is generated.
+  bool Index();
+
   bool Generate();
 
   bool GenerateEnumsBegin();
@@ -78,6 +139,20 @@ public:
 
   bool GenerateMain();
 
+  bool GeneratePlugins();
+
+  bool GenerateBench();
+
+  bool GenerateInstances();
+
+  bool GenerateClassIds();
+
+  bool GeneratePch();
+
+  bool GenerateReport();
+
+  bool GenerateSupport();
+
   int Save(const std::string &theFilePath) const;
 
   bool Load(const std::string &theFilePath);
@@ -92,6 +167,27 @@ private:
   std::vector<std::string> myClangArgs{};
   std::shared_ptr<Binder_Module> myCurMod;
   std::set<std::string> myVisitedClasses{};
+  std::set<std::string> myTableClasses{};
+  Binder_Index myClassIndex{};
+  std::vector<std::string> mySources{};
+  std::set<std::string> myIncludes{};
+
+  struct Instance {
+    std::string include{};
+    bool isValue = false;
+    std::set<std::string> modules{};
+  };
+
+  std::map<std::string, Instance> myInstances{};
+  std::map<std::string, std::string> myClassKeys{}; // include by class
+  std::ostringstream myRanges{};
+  std::ostringstream myPruned{};
+  std::map<std::string, std::set<std::string>> myDependencies{};
+  std::map<std::string, std::string> myIndexedUnits{}; // saved by Index()
+  std::map<std::string, std::set<std::string>> myBaseDependencies{};
+  std::map<std::string, std::map<std::string, std::string>> myForeignBases{};
+  std::map<std::string, int> myClassIds{};
+  std::vector<std::vector<int>> myDisplays{}; // the ancestors, root first
 };
 
 #endif
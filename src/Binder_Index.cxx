@@ -0,0 +1,142 @@
+#include "Binder_Index.hxx"
+#include "Binder_Util.hxx"
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+void Binder_Index::AddClass(const std::string &theClass) {
+  myClasses[theClass];
+}
+
+void Binder_Index::AddBase(const std::string &theClass,
+                           const std::string &theBase) {
+  myClasses[theClass].bases.push_back(theBase);
+}
+
+void Binder_Index::AddUse(const std::string &theClass,
+                          const std::string &theMember,
+                          const std::string &theType) {
+  myClasses[theClass].uses[theMember].insert(theType);
+}
+
+/// Adds the identifiers of |theText| to |theNames|, e.g. `LuaOCCT`, `gp`,
+/// `gp_Pnt` and `Distance` of `LuaOCCT.gp.gp_Pnt(1, 2, 3):Distance(p)`.
+static void scanNames(const std::string &theText,
+                      std::set<std::string> &theNames) {
+  std::size_t aPos = 0;
+
+  while (aPos < theText.size()) {
+    unsigned char aChar = theText[aPos];
+
+    // Not the exponent of 1e10 either.
+    if (std::isdigit(aChar)) {
+      while (aPos < theText.size() &&
+             std::isalnum(static_cast<unsigned char>(theText[aPos])))
+        aPos++;
+
+      continue;
+    }
+
+    if (!std::isalpha(aChar) && aChar != '_') {
+      aPos++;
+      continue;
+    }
+
+    std::size_t anEnd = aPos;
+
+    while (anEnd < theText.size() &&
+           (std::isalnum(static_cast<unsigned char>(theText[anEnd])) ||
+            theText[anEnd] == '_'))
+      anEnd++;
+
+    theNames.insert(theText.substr(aPos, anEnd - aPos));
+    aPos = anEnd;
+  }
+}
+
+bool Binder_Index::Reach(const std::string &theDir) {
+  if (!std::filesystem::is_directory(theDir)) {
+    std::cout << "Not a script directory: " << theDir << '\n';
+    return false;
+  }
+
+  int aNbScripts = 0;
+
+  for (const auto &anEntry :
+       std::filesystem::recursive_directory_iterator(theDir)) {
+    if (anEntry.path().extension() != ".lua")
+      continue;
+
+    std::ifstream aStream{anEntry.path()};
+    std::ostringstream aText{};
+    aText << aStream.rdbuf();
+    scanNames(aText.str(), myNames);
+    aNbScripts++;
+  }
+
+  std::vector<std::string> aQueue{};
+
+  for (const auto &[aClass, aNode] : myClasses) {
+    if (Binder_Util_Contains(myNames, aClass))
+      aQueue.push_back(aClass);
+  }
+
+  while (!aQueue.empty()) {
+    std::string aClass = aQueue.back();
+    aQueue.pop_back();
+
+    if (!myReachable.insert(aClass).second)
+      continue;
+
+    const Node &aNode = myClasses.at(aClass);
+
+    for (const auto &aBase : aNode.bases) {
+      if (HasClass(aBase))
+        aQueue.push_back(aBase);
+    }
+
+    for (const auto &[aMember, aTypes] : aNode.uses) {
+      if (!aMember.empty() && !IsMemberReachable(aMember))
+        continue;
+
+      for (const auto &aType : aTypes) {
+        if (HasClass(aType))
+          aQueue.push_back(aType);
+      }
+    }
+  }
+
+  myIsReached = true;
+  std::cout << "Usage: " << myReachable.size() << " of " << myClasses.size()
+            << " classes reachable from " << aNbScripts << " scripts\n"
+            << std::endl;
+
+  return true;
+}
+
+bool Binder_Index::IsReachable(const std::string &theClass) const {
+  return !myIsReached || Binder_Util_Contains(myReachable, theClass);
+}
+
+bool Binder_Index::IsMemberReachable(const std::string &theMember) const {
+  // Operators are called by the Lua metamethods, a static method with a
+  // non-static overload is named with a trailing `_`.
+  return !myIsReached || Binder_Util_StartsWith(theMember, "operator") ||
+         Binder_Util_Contains(myNames, theMember) ||
+         Binder_Util_Contains(myNames, theMember + '_');
+}
+
+bool Binder_Index::HasDerived(const std::string &theClass) const {
+  for (const auto &[aClass, aNode] : myClasses) {
+    if (std::find(aNode.bases.cbegin(), aNode.bases.cend(), theClass) !=
+            aNode.bases.cend() &&
+        IsReachable(aClass))
+      return true;
+  }
+
+  return false;
+}
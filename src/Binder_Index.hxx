@@ -0,0 +1,55 @@
+#ifndef _LuaOCCT_Binder_Index_HeaderFile
+#define _LuaOCCT_Binder_Index_HeaderFile
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+/// The bound classes of all the modules, with the types their members use.
+/// Built by a pre-pass over the modules, before any is generated.
+class Binder_Index {
+public:
+  void AddClass(const std::string &theClass);
+
+  void AddBase(const std::string &theClass, const std::string &theBase);
+
+  /// |theMember| of |theClass| uses |theType|, |theMember| is empty for the
+  /// constructors and fields.
+  void AddUse(const std::string &theClass, const std::string &theMember,
+              const std::string &theType);
+
+  bool HasClass(const std::string &theClass) const {
+    return myClasses.count(theClass) != 0;
+  }
+
+  std::size_t NbClasses() const { return myClasses.size(); }
+
+  /// Whether a kept class derives from |theClass|.
+  bool HasDerived(const std::string &theClass) const;
+
+  /// Keeps the classes named in the Lua scripts under |theDir|, closed over
+  /// their bases and the types of their members also named in the scripts.
+  bool Reach(const std::string &theDir);
+
+  /// Whether |theClass| is kept, all classes are without Reach().
+  bool IsReachable(const std::string &theClass) const;
+
+  /// Whether the methods called |theMember| are kept.
+  bool IsMemberReachable(const std::string &theMember) const;
+
+  std::size_t NbReachable() const { return myReachable.size(); }
+
+private:
+  struct Node {
+    std::vector<std::string> bases{};
+    std::map<std::string, std::set<std::string>> uses{};
+  };
+
+  std::map<std::string, Node> myClasses{};
+  std::set<std::string> myNames{};
+  std::set<std::string> myReachable{};
+  bool myIsReached = false;
+};
+
+#endif
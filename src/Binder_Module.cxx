@@ -1,11 +1,14 @@
 #include "Binder_Module.hxx"
 #include "Binder_Generator.hxx"
+#include "Binder_Index.hxx"
 #include "Binder_Util.hxx"
 
 #include <algorithm>
+#include <filesystem>
 #include <iterator>
 #include <map>
 #include <regex>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -170,7 +173,9 @@ getTemplateInstanceArgMap(const Binder_Cursor &theCursor) {
 Binder_Module::Binder_Module(const std::string &theName,
                              Binder_Generator &theParent)
     : myName(theName), myParent(&theParent), myIndex(nullptr),
-      myTransUnit(nullptr) {
+      myTransUnit(nullptr), myNbShards(1), myNbHelpers(0), myNbPruned(0),
+      myNbDispatchers(0), myNbFastPaths(0), myNbTables(0),
+      myNbEnumTables(0), myNbEmplaced(0) {
   myExportDir = myParent->ExportDir();
   myMetaExportDir = myParent->ExportDir() + "/_meta/";
 }
@@ -237,14 +242,42 @@ bool Binder_Module::generateEnumCast(const Binder_Cursor &theEnum) {
 
   std::cout << "Binding enum cast: " << anEnumSpelling << '\n';
 
+  std::string anInclude = myParent->IncludeName(theEnum.File());
+  if (!anInclude.empty())
+    myEnumIncludes.insert(anInclude);
+
+  std::set<long long> aValues{};
+
+  for (const auto &anEnumConst : anEnumConsts)
+    aValues.insert(anEnumConst.EnumConstValue());
+
+  long long aMin = *aValues.cbegin();
+  long long aMax = *aValues.crbegin();
+  std::string aCheck{};
+
+  // A bounds check if dense, else a binary search of the sorted values.
+  if (static_cast<unsigned long long>(aMax) -
+          static_cast<unsigned long long>(aMin) ==
+      aValues.size() - 1) {
+    aCheck = "luaocct::enum_range<" + std::to_string(aMin) + ',' +
+             std::to_string(aMax) + '>';
+  } else {
+    myEnumStream << "namespace luaocct::values {\ninline constexpr lua_Integer "
+                 << anEnumSpelling << "[] = {"
+                 << Binder_Util_Join(aValues.cbegin(), aValues.cend(),
+                                     [](long long theValue) {
+                                       return std::to_string(theValue);
+                                     })
+                 << "};\n}\n";
+    aCheck = "luaocct::enum_sorted<luaocct::values::" + anEnumSpelling + ',' +
+             std::to_string(aValues.size()) + '>';
+  }
+
+  std::string anEnum =
+      "luaocct::enum_stack<" + anEnumSpelling + ',' + aCheck + '>';
+
   myEnumStream << "template<> struct luabridge::Stack<" << anEnumSpelling
-               << "> : luabridge::Enum<" << anEnumSpelling << ','
-               << Binder_Util_Join(anEnumConsts.cbegin(), anEnumConsts.cend(),
-                                   [&](const Binder_Cursor &theEnumConst) {
-                                     return anEnumSpelling +
-                                            "::" + theEnumConst.Spelling();
-                                   })
-               << ">{};\n";
+               << "> : " << anEnum << "{};\n";
 
   return true;
 }
@@ -257,21 +290,32 @@ bool Binder_Module::generateEnumValue(const Binder_Cursor &theEnum) {
     return false;
 
   std::cout << "Binding enum: " << anEnumSpelling << '\n';
+  useDecl(theEnum);
 
-  mySourceStream << ".beginNamespace(\"" << anEnumSpelling << "\")\n";
   myMetaStream << "---@enum " << anEnumSpelling << '\n';
   myMetaStream << "LuaOCCT." << myName << '.' << anEnumSpelling << " = {\n";
 
+  // A plain table of the values known now, filled outside the chain.
+  if (!anEnumConsts.empty()) {
+    myBlock.raw = true;
+    myBlock.localIncludes.insert("lsupport.h");
+    mySourceStream << "{\nstatic const luaocct::enum_field FIELDS[] = {\n";
+  }
+
   for (const auto anEnumConst : anEnumConsts) {
     std::string anEnumConstSpelling = anEnumConst.Spelling();
-    mySourceStream << ".addProperty(\"" << anEnumConstSpelling
-                   << "\",+[](){ return " << anEnumSpelling
-                   << "::" << anEnumConstSpelling << "; })\n";
-    myMetaStream << '\t' << anEnumConstSpelling << " = "
-                 << clang_getEnumConstantDeclValue(anEnumConst) << ",\n";
+    long long aValue = anEnumConst.EnumConstValue();
+    mySourceStream << "{\"" << anEnumConstSpelling << "\"," << aValue
+                   << "},\n";
+    myMetaStream << '\t' << anEnumConstSpelling << " = " << aValue << ",\n";
+  }
+
+  if (!anEnumConsts.empty()) {
+    mySourceStream << "};\nluaocct::enum_table(L,\"" << myName << "\",\""
+                   << anEnumSpelling << "\",FIELDS);\n}\n\n";
+    myNbEnumTables++;
   }
 
-  mySourceStream << ".endNamespace()\n\n";
   myMetaStream << "}\n\n";
 
   return true;
@@ -291,9 +335,11 @@ bool Binder_Module::generateCtor(const Binder_Cursor &theClass,
   std::vector<Binder_Cursor> aCtorsb = theClass.Ctors(true);
   // Remove move ctor.
   std::vector<Binder_Cursor> aCtors{};
-  std::copy_if(
-      aCtorsb.cbegin(), aCtorsb.cend(), std::back_inserter(aCtors),
-      +[](const Binder_Cursor &cursor) { return !cursor.IsMoveCtor(); });
+  std::copy_if(aCtorsb.cbegin(), aCtorsb.cend(), std::back_inserter(aCtors),
+               [&](const Binder_Cursor &cursor) {
+                 return !cursor.IsMoveCtor() &&
+                        isCallable(cursor, aClassSpelling);
+               });
 
   // if no public ctor but non-public, do not bind any ctor.
   if (aCtors.empty() && !needsDefaultCtor)
@@ -321,6 +367,10 @@ bool Binder_Module::generateCtor(const Binder_Cursor &theClass,
           std::ostringstream oss{};
           oss << "void(";
           std::vector<Binder_Cursor> aParams = theCtor.Parameters();
+
+          for (const auto &aParam : aParams)
+            useType(aParam.Type());
+
           oss << Binder_Util_Join(aParams.cbegin(), aParams.cend(),
                                   [&](const Binder_Cursor &theParam) {
                                     //  return theParam.Type().Spelling();
@@ -386,6 +436,227 @@ static bool isIgnoredMethod(const Binder_Cursor &theMethod) {
   return false;
 }
 
+/// Whether |theType| is a number, a boolean or an enum, by value or const
+/// reference, or void for a result.
+static bool isNumeric(const Binder_Type &theType, bool theIsResult) {
+  Binder_Type aType = theType;
+
+  if (aType.IsLvalue()) {
+    aType = aType.GetPointee();
+
+    // A parameter by reference is an output.
+    if (!theIsResult && !aType.IsConstQualified())
+      return false;
+  } else if (aType.IsPointerLike()) {
+    return false;
+  }
+
+  switch (aType.GetCanonical().Kind()) {
+  case CXType_Void:
+    return theIsResult;
+  case CXType_Bool:
+  case CXType_UShort:
+  case CXType_UInt:
+  case CXType_ULong:
+  case CXType_ULongLong:
+  case CXType_Short:
+  case CXType_Int:
+  case CXType_Long:
+  case CXType_LongLong:
+  case CXType_Float:
+  case CXType_Double:
+  case CXType_Enum:
+    return true;
+  default:
+    return false;
+  }
+}
+
+/// The lua_CFunction of an in/out method with several results or with class
+/// out parameters, the result and the out parameters pushed as multiple
+/// values, neither a std::tuple nor a Lua table in between. Given after the
+/// in parameters, the class out parameters are filled in place and pushed
+/// back as they are, nothing is allocated.
+std::string Binder_Module::generateInOut(
+    const Binder_Cursor &theMethod, const std::vector<Binder_Cursor> &theIn,
+    const std::vector<Binder_Cursor> &theOut, const std::string &theMeta,
+    bool theGenMeta, const CursorInfo &theInfo) {
+  const std::string &aClassSpelling = theInfo.spelling;
+  bool anIsStatic = theMethod.IsStaticMethod();
+  int aFirst = anIsStatic ? 1 : 2;
+  std::ostringstream oss{};
+
+  myBlock.localIncludes.insert("lsupport.h");
+  // Errors raised once the locals are destroyed, see luaocct::protect.
+  oss << "+[](lua_State *L)->int{ return luaocct::protect(L,[&]()->int{ ";
+
+  // The class out parameters, in place if given, e.g. P of D0(U, P).
+  std::vector<Binder_Cursor> anInPlace{};
+
+  for (const auto &anOutParam : theOut) {
+    if (isBoundClass(anOutParam.Type().GetPointee()))
+      anInPlace.push_back(anOutParam);
+  }
+
+  // The exact arity, LuaBridge tries the next overload of the set on error.
+  std::size_t anArity = aFirst - 1 + theIn.size();
+  oss << "const int __top__=lua_gettop(L); if(__top__!=" << anArity;
+
+  if (!anInPlace.empty())
+    oss << "&&__top__!=" << anArity + anInPlace.size();
+
+  oss << ")luaocct::fail(\"" << anArity << " arguments expected\"); ";
+
+  std::string aCheck{};
+
+  if (!anIsStatic) {
+    oss << "auto *__theSelf__=luaocct::fast_self<"
+        << (theMethod.IsConstMethod() ? "const " : "") << aClassSpelling
+        << ">(L); ";
+    aCheck = "__theSelf__==nullptr";
+  }
+
+  // The locals are named by position, a parameter may be called L.
+  for (std::size_t i = 0; i < theIn.size(); ++i) {
+    std::string aLocal = "__a" + std::to_string(i) + "__";
+    oss << "auto " << aLocal << "=luaocct::get_arg<"
+        << normalizedTypeSpelling(theIn[i].Type(), theInfo) << ">(L,"
+        << aFirst + i << "); ";
+    aCheck += (aCheck.empty() ? "!" : "||!") + aLocal;
+  }
+
+  if (!aCheck.empty())
+    oss << "if(" << aCheck
+        << ")luaocct::fail(\"invalid argument\"); ";
+
+  if (!anInPlace.empty())
+    oss << "const bool __inPlace__=__top__==" << anArity + anInPlace.size()
+        << "; ";
+
+  std::vector<std::string> aResults{};
+  std::vector<std::string> aSlots{};
+  int aSlot = aFirst + static_cast<int>(theIn.size());
+
+  for (std::size_t i = 0; i < theOut.size(); ++i) {
+    const Binder_Cursor &anOutParam = theOut[i];
+    std::string aType =
+        normalizedTypeSpelling(anOutParam.Type().GetPointee(), theInfo);
+    std::string aName = "__o" + std::to_string(i) + "__";
+    std::string aResult = "std::move(" + aName + ')';
+
+    if (!isBoundClass(anOutParam.Type().GetPointee())) {
+      oss << aType << ' ' << aName << "{}; ";
+      aResults.push_back(aResult);
+      aSlots.push_back(aResult);
+      continue;
+    }
+
+    // Constructed only if not given.
+    std::string aFresh = "__v" + std::to_string(i) + "__";
+    oss << "std::optional<" << aType << "> " << aFresh << "{}; " << aType
+        << " &" << aName << "=luaocct::out_arg(L," << aSlot << ',' << aFresh
+        << ",__inPlace__); ";
+    aResults.push_back(aResult);
+    aSlots.push_back("luaocct::slot{" + std::to_string(aSlot++) + '}');
+  }
+
+  Binder_Type aRetType = theMethod.ReturnType();
+  std::string aRetTypeSpelling =
+      normalizedTypeSpelling(aRetType.Spelling(), theInfo);
+  bool anHasRetVal = aRetTypeSpelling != "void";
+
+  if (anHasRetVal) {
+    oss << aRetTypeSpelling << " __theRet__=";
+    // A returned reference is copied, not moved from.
+    std::string aResult = aRetTypeSpelling.back() == '&'
+                              ? "__theRet__"
+                              : "std::move(__theRet__)";
+    aResults.insert(aResults.begin(), aResult);
+    aSlots.insert(aSlots.begin(), aResult);
+  }
+
+  std::vector<Binder_Cursor> aParams = theMethod.Parameters();
+  std::size_t aNbIn = 0;
+  std::size_t aNbOut = 0;
+
+  oss << (anIsStatic ? aClassSpelling + "::" : "__theSelf__->")
+      << theMethod.Spelling() << '('
+      << Binder_Util_Join(
+             aParams.cbegin(), aParams.cend(),
+             [&](const Binder_Cursor &theParam) {
+               bool isOut =
+                   aNbOut < theOut.size() &&
+                   clang_equalCursors(theParam, theOut[aNbOut]) != 0;
+
+               if (!isOut)
+                 return "luaocct::pass_arg<" +
+                        normalizedTypeSpelling(theParam.Type(), theInfo) +
+                        ">(*__a" + std::to_string(aNbIn++) + "__)";
+
+               return (theParam.Type().IsPointer() ? "&" : "") +
+                      ("__o" + std::to_string(aNbOut++) + "__");
+             })
+      << "); ";
+
+  auto aJoin = [](const std::vector<std::string> &theValues) {
+    return Binder_Util_Join(
+        theValues.cbegin(), theValues.cend(),
+        [](const std::string &theValue) { return theValue; });
+  };
+
+  if (anInPlace.empty())
+    oss << "return luaocct::push_results(L," << aJoin(aResults) << "); }); }";
+  else
+    oss << "return __inPlace__?luaocct::push_results(L," << aJoin(aSlots)
+        << "):luaocct::push_results(L," << aJoin(aResults) << "); }); }";
+
+  if (theGenMeta) {
+    std::string aReturns{};
+
+    if (anHasRetVal)
+      aReturns = luaTypeMap(aRetType, theInfo);
+
+    for (const auto &anOutParam : theOut)
+      aReturns += (aReturns.empty() ? "" : ",") +
+                  luaTypeMap(anOutParam.Type(), theInfo);
+
+    for (const auto &aParam : theIn)
+      myMetaStream << "---@param " << aParam.Spelling() << ' '
+                   << luaTypeMap(aParam.Type(), theInfo) << '\n';
+
+    if (anHasRetVal)
+      myMetaStream << "---@return " << luaTypeMap(aRetType, theInfo) << '\n';
+
+    for (const auto &anOutParam : theOut)
+      myMetaStream << "---@return " << luaTypeMap(anOutParam.Type(), theInfo)
+                   << ' ' << anOutParam.Spelling() << '\n';
+
+    // The in place form.
+    if (!anInPlace.empty()) {
+      std::vector<Binder_Cursor> anArgs = theIn;
+      anArgs.insert(anArgs.end(), anInPlace.cbegin(), anInPlace.cend());
+      myMetaStream << "---@overload fun(" << (anIsStatic ? "" : "self")
+                   << (anIsStatic || anArgs.empty() ? "" : ",")
+                   << Binder_Util_Join(anArgs.cbegin(), anArgs.cend(),
+                                       [&](const Binder_Cursor &theParam) {
+                                         return theParam.Spelling() + ':' +
+                                                luaTypeMap(theParam.Type(),
+                                                           theInfo);
+                                       })
+                   << "):" << aReturns << '\n';
+    }
+
+    myMetaStream << theMeta << '('
+                 << Binder_Util_Join(theIn.cbegin(), theIn.cend(),
+                                     [](const Binder_Cursor &theParam) {
+                                       return theParam.Spelling();
+                                     })
+                 << ") end\n\n";
+  }
+
+  return oss.str();
+}
+
 std::string Binder_Module::generateMethod(const Binder_Cursor &theClass,
                                           const Binder_Cursor &theMethod,
                                           const std::string &theSuffix,
@@ -398,11 +669,39 @@ std::string Binder_Module::generateMethod(const Binder_Cursor &theClass,
 
   std::string aFuncName = aClassSpelling + "::" + aMethodSpelling;
 
+  for (const auto &aParam : aParams)
+    useType(aParam.Type());
+
+  useType(theMethod.ReturnType());
+
   if (Binder_Util_Contains(binder_config.myManualMethod, aFuncName)) {
     return binder_config.myManualMethod.at(aFuncName);
   }
 
   if (theMethod.IsOperator()) {
+    // Shared helpers of lsupport.h, by C++ operator.
+    static const std::unordered_map<std::string, std::string> HELPERS{
+        {"+", "op_add"}, {"-", "op_sub"}, {"*", "op_mul"},
+        {"/", "op_div"}, {"==", "op_eq"},
+    };
+
+    std::string aSelf =
+        (theMethod.IsConstMethod() ? "const " : "") + aClassSpelling;
+    std::string anOp = aMethodSpelling.substr(8);
+
+    if (aParams.empty() && anOp == "-") {
+      myBlock.localIncludes.insert("lsupport.h");
+      myNbHelpers++;
+      return "&luaocct::op_unm<" + aSelf + ">";
+    }
+
+    if (!aParams.empty() && Binder_Util_Contains(HELPERS, anOp)) {
+      myBlock.localIncludes.insert("lsupport.h");
+      myNbHelpers++;
+      return "&luaocct::" + HELPERS.at(anOp) + '<' + aSelf + ',' +
+             normalizedTypeSpelling(aParams[0].Type(), theInfo) + '>';
+    }
+
     oss << "+[](" << (theMethod.IsConstMethod() ? "const " : "")
         << aClassSpelling << " &theSelf";
 
@@ -441,6 +740,15 @@ std::string Binder_Module::generateMethod(const Binder_Cursor &theClass,
     theMethod.GetInOutParams(anIn, anOut);
     bool anIsStatic = theMethod.IsStaticMethod();
 
+    bool anHasClassOut = std::any_of(
+        anOut.cbegin(), anOut.cend(), [](const Binder_Cursor &theParam) {
+          return theParam.Type().GetPointee().GetCanonical().IsRecord();
+        });
+
+    if (anHasClassOut ||
+        anOut.size() + (theMethod.ReturnType().Spelling() != "void") >= 2)
+      return generateInOut(theMethod, anIn, anOut, aF, genMeta, theInfo);
+
     oss << "+[](";
 
     if (!anIsStatic) {
@@ -464,21 +772,8 @@ std::string Binder_Module::generateMethod(const Binder_Cursor &theClass,
         normalizedTypeSpelling(aRetType.Spelling(), theInfo);
     bool anHasRetVal = aRetTypeSpelling != "void";
     int nbReturn = (int)anHasRetVal + anOut.size();
-    bool anTupleOut = nbReturn >= 2;
-
-    if (anTupleOut) {
-      oss << ")->std::tuple<";
-
-      if (anHasRetVal)
-        oss << aRetTypeSpelling << ',';
 
-      oss << Binder_Util_Join(anOut.cbegin(), anOut.cend(),
-                              [&](const Binder_Cursor &theParam) {
-                                return normalizedTypeSpelling(
-                                    theParam.Type().GetPointee(), theInfo);
-                              })
-          << "> { ";
-    } else if (nbReturn == 1) {
+    if (nbReturn == 1) {
       if (anOut.empty())
         oss << ") { ";
       else
@@ -515,20 +810,7 @@ std::string Binder_Module::generateMethod(const Binder_Cursor &theClass,
                })
         << ");";
 
-    if (anTupleOut) {
-      oss << "return {";
-
-      if (anHasRetVal) {
-        oss << "__theRet__,";
-      }
-
-      oss << Binder_Util_Join(
-                 anOut.cbegin(), anOut.cend(),
-                 +[](const Binder_Cursor &theParam) {
-                   return theParam.Spelling();
-                 })
-          << "}; }";
-    } else if (nbReturn == 1) {
+    if (nbReturn == 1) {
       if (anOut.empty())
         oss << "return __theRet__; }";
       else
@@ -542,22 +824,11 @@ std::string Binder_Module::generateMethod(const Binder_Cursor &theClass,
         myMetaStream << "---@param " << it->Spelling() << ' '
                      << luaTypeMap(it->Type(), theInfo) << '\n';
       }
-      if (anTupleOut) {
-        myMetaStream << "---@return {";
-        int i = 1;
-        if (anHasRetVal) {
-          myMetaStream << '[' << i << "]:" << luaTypeMap(aRetType, theInfo)
-                       << ',';
-          ++i;
-        }
-        for (const auto &o : anOut) {
-          myMetaStream << '[' << i << "]:" << luaTypeMap(o.Type(), theInfo)
-                       << ',';
-          ++i;
-        }
-        myMetaStream << '}' << '\n';
-      } else if (nbReturn == 1) {
-        myMetaStream << "---@return " << luaTypeMap(aRetType, theInfo) << '\n';
+      if (nbReturn == 1) {
+        myMetaStream << "---@return "
+                     << luaTypeMap(anOut.empty() ? aRetType : anOut[0].Type(),
+                                   theInfo)
+                     << '\n';
       }
 
       myMetaStream << aF << '('
@@ -600,7 +871,33 @@ std::string Binder_Module::generateMethod(const Binder_Cursor &theClass,
     }
     myMetaStream << '\n';
   } else {
-    oss << '&' << aClassSpelling << "::" << aMethodSpelling;
+    bool isFast = isNumeric(theMethod.ReturnType(), true) &&
+                  std::all_of(aParams.cbegin(), aParams.cend(),
+                              [](const Binder_Cursor &theParam) {
+                                return isNumeric(theParam.Type(), false);
+                              });
+
+    // A bound class by value, e.g. a TopoDS_Shape, not a handle.
+    Binder_Type aResult = theMethod.ReturnType();
+    bool isEmplaced = !aResult.IsPointerLike() &&
+                      aResult.GetCanonical().IsRecord() &&
+                      myParent->ClassIndex().HasClass(
+                          aResult.GetDeclaration().Spelling());
+
+    if (isFast) {
+      oss << "&luaocct::fast<&" << aClassSpelling << "::" << aMethodSpelling
+          << '>';
+      myBlock.localIncludes.insert("lsupport.h");
+      myNbFastPaths++;
+    } else if (isEmplaced) {
+      oss << "&luaocct::emplace<&" << aClassSpelling << "::" << aMethodSpelling
+          << '>';
+      myBlock.localIncludes.insert("lsupport.h");
+      myNbEmplaced++;
+    } else {
+      oss << '&' << aClassSpelling << "::" << aMethodSpelling;
+    }
+
     for (auto it = aParams.cbegin(); it != aParams.cend(); ++it) {
       myMetaStream << "---@param " << it->Spelling() << ' '
                    << luaTypeMap(it->Type(), theInfo) << '\n';
@@ -621,6 +918,107 @@ std::string Binder_Module::generateMethod(const Binder_Cursor &theClass,
   return oss.str();
 }
 
+/// Depth of |theClass| in its hierarchy, 0 for a root.
+static int classDepth(const Binder_Cursor &theClass) {
+  int aDepth = 0;
+
+  for (const auto &aBase : theClass.Bases())
+    aDepth = std::max(aDepth, 1 + classDepth(aBase.GetDefinition()));
+
+  return aDepth;
+}
+
+/// Rank of a parameter type in a dispatch, higher for the types matching
+/// fewer Lua values: an integer before a real, a class before its bases.
+static int specificity(const Binder_Type &theType) {
+  Binder_Type aType =
+      (theType.IsPointerLike() ? theType.GetPointee() : theType).GetCanonical();
+
+  if (aType.Kind() == CXType_Bool || aType.Kind() == CXType_Enum)
+    return 4;
+
+  if (aType.Kind() >= CXType_Char_U && aType.Kind() <= CXType_Int128)
+    return 3;
+
+  if (aType.Kind() >= CXType_Float && aType.Kind() <= CXType_LongDouble)
+    return 1;
+
+  // e.g. handle<Geom_Line> before handle<Geom_Curve>
+  if (aType.Kind() == CXType_Record) {
+    Binder_Type aClass = aType.GetNumTempalteArguments() > 0
+                             ? aType.GetTemplateArgumentAsType(0)
+                             : aType;
+    return 5 + classDepth(aClass.GetDeclaration());
+  }
+
+  return 2;
+}
+
+/// The lua_CFunction of an overload group, in place of luabridge::overload
+/// trying each candidate in turn. Empty if a candidate is not a plain method.
+std::string Binder_Module::generateDispatcher(
+    const Binder_Cursor &theClass, const std::vector<Binder_Cursor> &theMethods,
+    const std::string &theSuffix, const CursorInfo &theInfo) {
+  if (theMethods.size() < 2)
+    return "";
+
+  for (const auto &aMethod : theMethods) {
+    if (aMethod.IsOperator() || aMethod.NeedsInOutMethod())
+      return "";
+  }
+
+  bool isStatic = theMethods[0].IsStaticMethod();
+  int aFirst = isStatic ? 1 : 2;
+
+  // By number of arguments, then by specificity of the parameters.
+  std::map<std::size_t, std::vector<std::pair<std::vector<int>, std::string>>>
+      aCases{};
+
+  for (const auto &aMethod : theMethods) {
+    std::vector<Binder_Cursor> aParams = aMethod.Parameters();
+    std::vector<int> aRanks{};
+
+    for (const auto &aParam : aParams)
+      aRanks.push_back(specificity(aParam.Type()));
+
+    std::ostringstream oss{};
+    oss << "if(luaocct::match<"
+        << Binder_Util_Join(aParams.cbegin(), aParams.cend(),
+                            [&](const Binder_Cursor &theParam) {
+                              return normalizedTypeSpelling(theParam.Type(),
+                                                            theInfo);
+                            })
+        << ">(L," << aFirst << "))return luaocct::call(L,"
+        << generateMethod(theClass, aMethod, theSuffix, theInfo, true)
+        << ");\n";
+    aCases[aParams.size() + aFirst - 1].emplace_back(aRanks, oss.str());
+  }
+
+  std::ostringstream oss{};
+  oss << "+[](lua_State *L)->int{\nswitch(lua_gettop(L)){\n";
+
+  for (auto &[aNbArgs, aCandidates] : aCases) {
+    std::stable_sort(aCandidates.begin(), aCandidates.end(),
+                     [](const auto &theA, const auto &theB) {
+                       return theA.first > theB.first;
+                     });
+    oss << "case " << aNbArgs << ":\n";
+
+    for (const auto &aCandidate : aCandidates)
+      oss << aCandidate.second;
+
+    oss << "break;\n";
+  }
+
+  oss << "}\nreturn luaocct::no_overload(L,\"" << theInfo.spelling
+      << "::" << theMethods[0].Spelling() << "\");\n}";
+
+  myBlock.localIncludes.insert("lsupport.h");
+  myNbDispatchers++;
+
+  return oss.str();
+}
+
 struct Binder_MethodGroup {
 public:
   void Add(const Binder_Cursor &theMethod) { myMethods.push_back(theMethod); }
@@ -674,6 +1072,12 @@ bool Binder_Module::generateMethods(const Binder_Cursor &theClass,
     bool aManual =
         Binder_Util_Contains(binder_config.myManualMethod, aFuncName);
 
+    if (!aManual && !myParent->ClassIndex().IsMemberReachable(aFuncSpelling))
+      continue;
+
+    if (!aManual && !isCallable(aMethod, aClassSpelling))
+      continue;
+
     if (aMethod.IsOperator()) {
       if (aFuncSpelling == "operator-") {
         if (aMethod.Parameters().empty()) {
@@ -703,17 +1107,27 @@ bool Binder_Module::generateMethods(const Binder_Cursor &theClass,
     const std::string aMethodMeta = "LuaOCCT." + myName + "." + aClassSpelling;
     const std::string &aMethodSpelling = anIter->first;
 
-    if (!aMtd.empty()) {
+    // Without instances, e.g. the operators of a function table.
+    if (!aMtd.empty() && theInfo.isTable) {
+      std::cout << "Skip non-static in function table: " << aClassSpelling
+                << "::" << aMethodSpelling << '\n';
+    } else if (!aMtd.empty()) {
       mySourceStream << ".addFunction(\"" << aMethodSpelling << "\",";
 
       if (aMethodGroup.HasOverload()) {
         myMetaStream << "---\n";
         // myMetaStream << "---@param ... any\n";
-        mySourceStream << Binder_Util_Join(
-            aMtd.cbegin(), aMtd.cend(),
-            [&, this](const Binder_Cursor &theMethod) {
-              return generateMethod(theClass, theMethod, "", theInfo, true);
-            });
+        std::string aDispatcher =
+            generateDispatcher(theClass, aMtd, "", theInfo);
+
+        if (!aDispatcher.empty())
+          mySourceStream << aDispatcher;
+        else
+          mySourceStream << Binder_Util_Join(
+              aMtd.cbegin(), aMtd.cend(),
+              [&, this](const Binder_Cursor &theMethod) {
+                return generateMethod(theClass, theMethod, "", theInfo, true);
+              });
         myMetaStream << "function " << aMethodMeta << ':' << aMethodSpelling
                      << "(...) end\n\n";
       } else {
@@ -725,19 +1139,28 @@ bool Binder_Module::generateMethods(const Binder_Cursor &theClass,
 
     if (!aMtdSt.empty()) {
       std::string suffix =
-          (aMtd.empty() ? ""
-                        : "_"); /* Add a "_" if there is non-static overload. */
-      mySourceStream << ".addStaticFunction(\"" << aMethodSpelling << suffix
-                     << "\",";
+          (aMtd.empty() || theInfo.isTable
+               ? ""
+               : "_"); /* Add a "_" if there is non-static overload. */
+      mySourceStream << (theInfo.isTable ? ".addFunction(\""
+                                         : ".addStaticFunction(\"")
+                     << aMethodSpelling << suffix << "\",";
 
       if (aMethodGroup.HasOverload()) {
         myMetaStream << "---\n";
         // myMetaStream << "---@param ... any\n";
-        mySourceStream << Binder_Util_Join(
-            aMtdSt.cbegin(), aMtdSt.cend(),
-            [&, this](const Binder_Cursor &theMethod) {
-              return generateMethod(theClass, theMethod, suffix, theInfo, true);
-            });
+        std::string aDispatcher =
+            generateDispatcher(theClass, aMtdSt, suffix, theInfo);
+
+        if (!aDispatcher.empty())
+          mySourceStream << aDispatcher;
+        else
+          mySourceStream << Binder_Util_Join(
+              aMtdSt.cbegin(), aMtdSt.cend(),
+              [&, this](const Binder_Cursor &theMethod) {
+                return generateMethod(theClass, theMethod, suffix, theInfo,
+                                      true);
+              });
         myMetaStream << "function " << aMethodMeta << '.' << aMethodSpelling
                      << suffix << "(...) end\n\n";
       } else {
@@ -753,10 +1176,12 @@ bool Binder_Module::generateMethods(const Binder_Cursor &theClass,
   }
 
   // DownCast from Standard_Transient
-  if (theClass.IsTransient() && aClassSpelling != "Standard_Transient") {
-    mySourceStream << ".addStaticFunction(\"DownCast\",+[](const "
-                      "Handle(Standard_Transient) &h){ return Handle("
-                   << aClassSpelling << ")::DownCast(h); })\n";
+  if (theClass.IsTransient() && aClassSpelling != "Standard_Transient" &&
+      !theInfo.isTable) {
+    mySourceStream << ".addStaticFunction(\"DownCast\",&luaocct::downcast<"
+                   << aClassSpelling << ">)\n";
+    myBlock.localIncludes.insert("lsupport.h");
+    myNbHelpers++;
     myMetaStream << "---Down casting operator from handle to " << aClassSpelling
                  << ".\n";
     myMetaStream << "---@param h Standard_Transient\n";
@@ -776,6 +1201,7 @@ bool Binder_Module::generateFields(const Binder_Cursor &theStruct,
 
   for (const auto &aField : aFields) {
     std::string aFieldSpelling = aField.Spelling();
+    useType(aField.Type());
     mySourceStream << ".addProperty(\"" << aFieldSpelling << "\",&"
                    << aStructSpelling << "::" << aFieldSpelling << ")\n";
     myMetaStream << "---@field " << aFieldSpelling << " "
@@ -792,9 +1218,12 @@ bool Binder_Module::generateStruct(const Binder_Cursor &theStruct,
     return true;
 
   std::cout << "Binding struct: " << aStructSpelling << '\n';
+  useDecl(theStruct);
 
   mySourceStream << ".beginClass<" << aStructSpelling << ">(\""
                  << aStructSpelling << "\")\n";
+  myBlock.classId = myParent->AddClassId(aStructSpelling, "");
+  myBlock.localIncludes.insert("lsupport.h");
   CursorInfo info = {false, theStruct, aStructSpelling, {}};
   myMetaStream << "---@class " << aStructSpelling << '\n';
   generateCtor(theStruct, info);
@@ -810,6 +1239,8 @@ bool Binder_Module::generateClass(const Binder_Cursor &theClass,
                                   const Binder_Generator *theParent) {
   std::string aClassSpelling = theClass.Spelling();
   std::cout << "Binding class: " << aClassSpelling << '\n';
+  useDecl(theClass);
+  useInstance(theClass, theClass.IsTransient());
 
   Binder_Type aType = theClass.Type();
   Binder_Cursor aCls = theClass;
@@ -830,31 +1261,638 @@ bool Binder_Module::generateClass(const Binder_Cursor &theClass,
   bool baseRegistered = false;
   for (const auto aBase : aBases) {
     // NOTE: Use definition spelling!
-    if (theParent->IsClassVisited(aBase.GetDefinition().Spelling())) {
+    std::string aBaseSpelling = aBase.GetDefinition().Spelling();
+
+    // Not indexed, a function table may still have derived classes.
+    if (theParent->IsTableClass(aBaseSpelling)) {
+      std::cout << "Skip function table base: " << aClassSpelling << " : "
+                << aBaseSpelling << '\n';
+      continue;
+    }
+
+    if (theParent->IsClassVisited(aBaseSpelling)) {
       baseRegistered = true;
       break;
     }
   }
 
   if (baseRegistered) {
-    std::string aBaseSpelling = aBases[0].GetDefinition().Spelling();
+    Binder_Cursor aBase = aBases[0].GetDefinition();
+    std::string aBaseSpelling = aBase.Spelling();
+    myBlock.bases.push_back(aBaseSpelling);
+
+    // Registered by another module, see Binder_Generator::GeneratePlugins.
+    std::string aBaseModule = myParent->FileModule(aBase.File());
+    myBlock.lazyBases.push_back(aBaseModule.empty() || aBaseModule == myName
+                                    ? aBaseSpelling
+                                    : aBaseModule + '.' + aBaseSpelling);
+
+    if (aBaseModule != myName) {
+      myParent->AddForeignBase(myName, aBaseSpelling,
+                               myParent->IncludeName(aBase.File()));
+
+      if (!aBaseModule.empty())
+        myParent->AddDependency(myName, aBaseModule, true);
+    }
+
     mySourceStream << ".deriveClass<" << aClassSpelling << ',' << aBaseSpelling
                    << ">(\"" << aClassSpelling << "\")\n";
+
+    myBlock.classId = myParent->AddClassId(aClassSpelling, aBaseSpelling);
     myMetaStream << "---@class " << aClassSpelling << " : " << aBaseSpelling
                  << '\n';
+  } else if (aCls.IsStaticClass() &&
+             !Binder_Util_Contains(binder_config.myExtraMethod,
+                                   aClassSpelling) &&
+             !myParent->ClassIndex().HasDerived(aClassSpelling)) {
+    // No instance, no metatable: a call is a rawget of the table.
+    info.isTable = true;
+    myParent->AddTableClass(aClassSpelling);
+    mySourceStream << ".beginNamespace(\"" << aClassSpelling << "\")\n";
+    myMetaStream << "---@class " << aClassSpelling << '\n';
+    myNbTables++;
   } else {
     mySourceStream << ".beginClass<" << aClassSpelling << ">(\""
                    << aClassSpelling << "\")\n";
     myMetaStream << "---@class " << aClassSpelling << '\n';
+    myBlock.classId = myParent->AddClassId(aClassSpelling, "");
   }
 
+  // See exportSource.
+  myBlock.localIncludes.insert("lsupport.h");
+
   generateCtor(aCls, info);
 
   myMetaStream << "LuaOCCT." << myName << '.' << aClassSpelling << " = {}\n\n";
 
   generateMethods(aCls, info);
 
-  mySourceStream << ".endClass()\n\n";
+  mySourceStream << (info.isTable ? ".endNamespace()\n\n" : ".endClass()\n\n");
+
+  return true;
+}
+
+void Binder_Module::useDecl(const Binder_Cursor &theDecl) {
+  std::string anInclude = myParent->IncludeName(theDecl.File());
+
+  if (!anInclude.empty())
+    myBlock.includes.insert(anInclude);
+
+  if (!theDecl.Parent().IsTransUnit())
+    return;
+
+  std::string aMod = myParent->FileModule(theDecl.File());
+
+  if (aMod.empty())
+    return;
+
+  if (aMod != myName)
+    myParent->AddDependency(myName, aMod);
+
+  // The luabridge::Stack of an enum lives in its module's enum header.
+  if (theDecl.IsEnum()) {
+    myBlock.localIncludes.insert("lenums_" + aMod + ".h");
+    return;
+  }
+
+  // A class must be registered before its values are pushed.
+  std::string aSpelling = theDecl.Spelling();
+
+  if (aSpelling != myBlock.name)
+    myBlock.uses.insert(aMod == myName ? aSpelling : aMod + '.' + aSpelling);
+}
+
+std::string Binder_Module::unregisteredType(const Binder_Type &theType) const {
+  Binder_Type aType = theType.IsPointerLike() ? theType.GetPointee() : theType;
+  Binder_Cursor aDecl = aType.GetDeclaration();
+
+  // Builtins, and their typedefs, e.g. Standard_Real.
+  if (aDecl.IsNull() || aType.GetCanonical().GetDeclaration().IsNull())
+    return "";
+
+  std::string aSpelling = aDecl.Spelling();
+  std::string aMod = aSpelling.substr(0, aSpelling.find('_'));
+  const auto &anExtras = binder_config.myExtraModules;
+
+  // Nested and namespaced declarations are left to the compiler, the enums
+  // have a luabridge::Stack.
+  bool isRegistered =
+      !aDecl.Parent().IsTransUnit() || aDecl.IsEnum() ||
+      Binder_Util_Contains(binder_config.myImmutableType, aSpelling) ||
+      myParent->ClassIndex().HasClass(aSpelling) ||
+      std::find(anExtras.cbegin(), anExtras.cend(), aMod) != anExtras.cend();
+
+  // e.g. a typedef of NCollection_Array1<gp_Pnt>.
+  if (!isRegistered && aDecl.IsTypeDef())
+    return unregisteredType(aDecl.UnderlyingTypedefType()).empty() ? ""
+                                                                  : aSpelling;
+
+  if (!isRegistered)
+    return aSpelling;
+
+  // e.g. handle<Geom_Curve>
+  for (int i = 0; i < aType.GetNumTempalteArguments(); ++i) {
+    std::string aMissing = unregisteredType(aType.GetTemplateArgumentAsType(i));
+
+    if (!aMissing.empty())
+      return aMissing;
+  }
+
+  return "";
+}
+
+bool Binder_Module::isBoundClass(const Binder_Type &theType) const {
+  return !theType.IsPointerLike() && theType.GetCanonical().IsRecord() &&
+         myParent->ClassIndex().HasClass(theType.GetDeclaration().Spelling());
+}
+
+bool Binder_Module::isCallable(const Binder_Cursor &theFunc,
+                               const std::string &theClass) {
+  if (!binder_config.myPruneSignatures)
+    return true;
+
+  std::vector<Binder_Type> aTypes{theFunc.ReturnType()};
+
+  for (const auto &aParam : theFunc.Parameters())
+    aTypes.push_back(aParam.Type());
+
+  for (const auto &aType : aTypes) {
+    std::string aMissing = unregisteredType(aType);
+
+    if (aMissing.empty())
+      continue;
+
+    myParent->AddPruned(myName, theClass, theFunc.Spelling(), aMissing);
+    myNbPruned++;
+
+    return false;
+  }
+
+  return true;
+}
+
+void Binder_Module::useInstance(const Binder_Cursor &theDecl,
+                                bool theIsHandle) {
+  if (theDecl.IsNull() || !theDecl.IsClass() ||
+      !theDecl.Parent().IsTransUnit())
+    return;
+
+  std::string aSpelling = theDecl.Spelling();
+  std::string anInclude = myParent->IncludeName(theDecl.File());
+
+  if (anInclude.empty() || myParent->FileModule(theDecl.File()).empty())
+    return;
+
+  myParent->AddClassKeys(aSpelling, anInclude);
+
+  // A transient is pushed by handle, the others by copy.
+  if (theIsHandle && theDecl.IsTransient())
+    myParent->AddInstance("opencascade::handle<" + aSpelling + '>',
+                          anInclude, myName, false);
+  else if (!theIsHandle && !theDecl.IsTransient() && theDecl.IsCopyable())
+    myParent->AddInstance(aSpelling, anInclude, myName, true);
+}
+
+void Binder_Module::useType(const Binder_Type &theType) {
+  Binder_Type aType = theType.IsPointerLike() ? theType.GetPointee() : theType;
+  Binder_Cursor aDecl = aType.GetDeclaration();
+
+  if (aDecl.IsNull())
+    return;
+
+  useDecl(aDecl);
+
+  if (aDecl.Spelling() == "handle" && aType.GetNumTempalteArguments() == 1)
+    useInstance(aType.GetTemplateArgumentAsType(0).GetDeclaration(), true);
+  else
+    useInstance(aDecl, false);
+
+  // e.g. handle<Geom_Curve>
+  for (int i = 0; i < aType.GetNumTempalteArguments(); ++i)
+    useType(aType.GetTemplateArgumentAsType(i));
+}
+
+void Binder_Module::beginBlock(const std::string &theName) {
+  myBlock = Block{};
+  myBlock.name = theName;
+  mySourceStream.str("");
+}
+
+void Binder_Module::endBlock() {
+  myBlock.code = mySourceStream.str();
+  mySourceStream.str("");
+
+  if (!myBlock.code.empty())
+    myBlocks.push_back(std::move(myBlock));
+}
+
+/// Distributes the blocks over |theNbShards| shards, balanced by emitted size.
+/// Shards are registered in order, so a derived class never goes to a shard
+/// before the one of its base.
+static std::vector<std::vector<std::size_t>>
+planShards(const std::vector<Binder_Module::Block> &theBlocks,
+           int theNbShards) {
+  std::vector<std::vector<std::size_t>> aShards(theNbShards);
+  std::vector<std::size_t> aLoads(theNbShards, 0);
+  std::unordered_map<std::string, int> aShardOf{};
+
+  for (std::size_t i = 0; i < theBlocks.size(); ++i) {
+    const Binder_Module::Block &aBlock = theBlocks[i];
+    int aFirst = 0;
+
+    for (const auto &aBase : aBlock.bases) {
+      auto anIter = aShardOf.find(aBase);
+      if (anIter != aShardOf.end())
+        aFirst = std::max(aFirst, anIter->second);
+    }
+
+    int aShard = aFirst;
+    for (int k = aFirst + 1; k < theNbShards; ++k) {
+      if (aLoads[k] < aLoads[aShard])
+        aShard = k;
+    }
+
+    aShards[aShard].push_back(i);
+    aLoads[aShard] += aBlock.code.size();
+    aShardOf[aBlock.name] = aShard;
+  }
+
+  return aShards;
+}
+
+bool Binder_Module::exportSource(
+    const std::string &thePath, const std::string &theFunc,
+    const std::vector<std::size_t> &theBlocks) const {
+  std::ostringstream aStream{};
+  std::set<std::string> anIncludes{};
+  std::set<std::string> aLocalIncludes{};
+  bool isLazy = binder_config.myLazyClasses && !binder_config.myPlugins;
+
+  for (std::size_t i : theBlocks) {
+    anIncludes.insert(myBlocks[i].includes.cbegin(),
+                      myBlocks[i].includes.cend());
+    aLocalIncludes.insert(myBlocks[i].localIncludes.cbegin(),
+                          myBlocks[i].localIncludes.cend());
+  }
+
+  myParent->AddSource(thePath, anIncludes);
+
+  aStream << "/* This file is generated, do not edit. */\n\n";
+  aStream << "#include <luaocct_bind/lbind.h>\n\n";
+
+  for (const auto &anInclude : anIncludes) {
+    aStream << "#include <" << anInclude << ">\n";
+  }
+
+  aStream << '\n';
+
+  for (const auto &aLocalInclude : aLocalIncludes) {
+    aStream << "#include \"" << aLocalInclude << "\"\n";
+  }
+
+  // After the OCCT includes, see Binder_Generator::GenerateInstances.
+  aStream << "#include \"linstances.h\"\n\n";
+
+  if (isLazy)
+    aStream << "#include \"llazy.h\"\n\n";
+  else
+    aStream << "\nvoid " << theFunc << "(lua_State *L) {\n";
+
+  // Line ranges of the blocks and of their members, the markers of the
+  // compile time and size reports.
+  std::string aSource = std::filesystem::path(thePath).filename().string();
+  std::string aHead = aStream.str();
+  std::size_t aLine = std::count(aHead.cbegin(), aHead.cend(), '\n') + 1;
+
+  // Chain blocks are joined into one builder chain, which is closed around
+  // raw blocks.
+  bool inChain = false;
+  std::string aFinishes{};
+
+  for (std::size_t i : theBlocks) {
+    const Block &aBlock = myBlocks[i];
+    std::string aGlue{};
+    std::string aFinish{};
+
+    // Once the class and its base are registered.
+    if (aBlock.classId >= 0)
+      aFinish = "luaocct::set_class_id<" + aBlock.name + ">(L," +
+                std::to_string(aBlock.classId) + ");\n";
+
+    if (binder_config.myFlattenMethods && !aBlock.raw && !aBlock.bases.empty())
+      aFinish += "luaocct::flatten<" + aBlock.name + ',' + aBlock.bases[0] +
+                 ">(L);\n";
+
+    // One registrar per block, see exportLazyEntry.
+    if (isLazy) {
+      std::string anEnd = "}\n\n";
+      aGlue = "void luaocct_class_" + aBlock.name + "(lua_State *L) {\n";
+
+      if (!aBlock.raw) {
+        aGlue += "luabridge::getGlobalNamespace(L)\n"
+                 ".beginNamespace(\"LuaOCCT\")\n"
+                 ".beginNamespace(\"" +
+                 myName + "\")\n\n";
+        anEnd = ".endNamespace()\n.endNamespace();\n" + aFinish + anEnd;
+      }
+
+      aStream << aGlue << aBlock.code << anEnd;
+      aLine += std::count(aGlue.cbegin(), aGlue.cend(), '\n');
+      aLine = addRanges(aSource, aLine, aBlock) +
+              std::count(anEnd.cbegin(), anEnd.cend(), '\n');
+      continue;
+    }
+
+    if (aBlock.raw && inChain) {
+      aGlue = ".endNamespace()\n.endNamespace();\n\n";
+      inChain = false;
+    } else if (!aBlock.raw && !inChain) {
+      aGlue = "luabridge::getGlobalNamespace(L)\n"
+              ".beginNamespace(\"LuaOCCT\")\n"
+              ".beginNamespace(\"" +
+              myName + "\")\n\n";
+      inChain = true;
+    }
+
+    aStream << aGlue << aBlock.code;
+    aLine += std::count(aGlue.cbegin(), aGlue.cend(), '\n');
+    aLine = addRanges(aSource, aLine, aBlock);
+    aFinishes += aFinish;
+  }
+
+  if (inChain)
+    aStream << ".endNamespace()\n.endNamespace();\n";
+
+  // In the order of the blocks, a base is finished before its derived.
+  if (!aFinishes.empty())
+    aStream << '\n' << aFinishes;
+
+  if (!isLazy)
+    aStream << "}\n";
+
+  std::ofstream{thePath} << aStream.str();
+
+  return true;
+}
+
+/// Writes the module entry of lazy_classes to |thePath|, the table of the
+/// registrars of its classes with their bases and uses.
+bool Binder_Module::exportLazyEntry(const std::string &thePath) const {
+  std::ofstream aStream{thePath, std::ios::app};
+  std::set<std::string> aNames{};
+
+  for (const auto &aBlock : myBlocks)
+    aNames.insert(aBlock.name);
+
+  aStream << '\n';
+
+  // The registrars of the other shards.
+  for (const auto &aBlock : myBlocks) {
+    if (myNbShards > 1)
+      aStream << "extern void luaocct_class_" << aBlock.name
+              << "(lua_State *L);\n";
+  }
+
+  const Binder_Index &anIndex = myParent->ClassIndex();
+
+  for (const auto &aBlock : myBlocks) {
+    const std::vector<std::string> &aBases = aBlock.lazyBases;
+    std::vector<std::string> aUses{};
+
+    for (const auto &aUse : aBlock.uses) {
+      std::size_t aDot = aUse.find('.');
+      bool isBound = aDot == std::string::npos
+                         ? Binder_Util_Contains(aNames, aUse)
+                         : anIndex.NbClasses() == 0 ||
+                               anIndex.HasClass(aUse.substr(aDot + 1));
+
+      if (isBound && std::find(aBases.cbegin(), aBases.cend(), aUse) ==
+                         aBases.cend())
+        aUses.push_back(aUse);
+    }
+
+    aStream << "static const char *const BASES_" << aBlock.name << "[] = {";
+
+    for (const auto &aBase : aBases)
+      aStream << '"' << aBase << "\", ";
+
+    aStream << "nullptr};\n";
+    aStream << "static const char *const USES_" << aBlock.name << "[] = {";
+
+    for (const auto &aUse : aUses)
+      aStream << '"' << aUse << "\", ";
+
+    aStream << "nullptr};\n";
+  }
+
+  aStream << "\nstatic const luaocct::lazy_entry CLASSES[] = {\n";
+
+  for (const auto &aBlock : myBlocks) {
+    aStream << "\t{\"" << aBlock.name << "\", &luaocct_class_" << aBlock.name
+            << ", BASES_" << aBlock.name << ", USES_" << aBlock.name
+            << "},\n";
+  }
+
+  aStream << "\t{nullptr, nullptr, nullptr, nullptr},\n};\n";
+  aStream << "\nvoid luaocct_init_" << myName << "(lua_State *L) {\n";
+  aStream << "\tluaocct::lazy_install(L, CLASSES, \"" << myName << "\");\n";
+  aStream << "}\n";
+  std::cout << "Lazy registrars: " << myBlocks.size() << '\n';
+
+  return true;
+}
+
+std::size_t Binder_Module::addRanges(const std::string &theSource,
+                                     std::size_t theLine,
+                                     const Block &theBlock) const {
+  std::istringstream aCode{theBlock.code};
+  std::string aText{};
+  std::size_t aLine = theLine;
+  std::size_t aFirst = 0;
+  std::string aMember{};
+
+  // A member starts at `.addFunction("Name", ...` and the like.
+  while (std::getline(aCode, aText)) {
+    std::size_t aQuote = aText.find("(\"");
+
+    if (Binder_Util_StartsWith(aText, ".add") && aQuote != std::string::npos) {
+      if (!aMember.empty())
+        myParent->AddRange(theSource, aFirst, aLine - 1, theBlock.name,
+                           aMember);
+
+      aFirst = aLine;
+      aMember = aText.substr(aQuote + 2,
+                             aText.find('"', aQuote + 2) - aQuote - 2);
+    }
+
+    aLine++;
+  }
+
+  if (!aMember.empty())
+    myParent->AddRange(theSource, aFirst, aLine - 1, theBlock.name, aMember);
+
+  if (aLine > theLine)
+    myParent->AddRange(theSource, theLine, aLine - 1, theBlock.name, "");
+
+  return aLine;
+}
+
+bool Binder_Module::exportEnums() const {
+  std::string aPath = myExportDir + "/lenums_" + myName + ".h";
+
+  std::ofstream aStream{aPath};
+  aStream << "/* This file is generated, do not edit. */\n\n";
+  aStream << "#ifndef _LuaOCCT_lenums_" << myName << "_HeaderFile\n#define "
+          << "_LuaOCCT_lenums_" << myName << "_HeaderFile\n\n";
+  aStream << "#include <luaocct_bind/lbind.h>\n\n";
+
+  for (const auto &anInclude : myEnumIncludes) {
+    aStream << "#include <" << anInclude << ">\n";
+  }
+
+  aStream << "\n#include \"lenum.h\"\n";
+
+  aStream << '\n' << myEnumStream.str();
+  aStream << "\n#endif\n";
+
+  return true;
+}
+
+struct Binder_Collection {
+  std::string binder;
+  std::vector<std::string> args;
+  std::vector<std::string> methods;
+};
+
+/// The binders of lcollection.h, with their methods for the meta files.
+/// A method is spelled `Name(param:Type,...):Return`, `K`, `V`, `K1`, `K2`
+/// standing for the template arguments and `M` for the map itself.
+static const std::map<std::string, Binder_Collection> COLLECTIONS{
+    {"NCollection_Map",
+     {"bind_map",
+      {"K"},
+      {"Add(theKey:K):boolean", "Contains(theKey:K):boolean",
+       "Remove(theKey:K):boolean", "Unite(theOther:M):boolean",
+       "Intersect(theOther:M):boolean", "Subtract(theOther:M):boolean",
+       "Differ(theOther:M):boolean"}}},
+    {"NCollection_IndexedMap",
+     {"bind_indexed_map",
+      {"K"},
+      {"Add(theKey:K):integer", "Contains(theKey:K):boolean",
+       "Substitute(theIndex:integer,theKey:K)",
+       "Swap(theIndex1:integer,theIndex2:integer)", "RemoveLast()",
+       "RemoveFromIndex(theIndex:integer)", "RemoveKey(theKey:K):boolean",
+       "FindKey(theIndex:integer):K", "FindIndex(theKey:K):integer"}}},
+    {"NCollection_DataMap",
+     {"bind_data_map",
+      {"K", "V"},
+      {"Bind(theKey:K,theItem:V):boolean", "IsBound(theKey:K):boolean",
+       "UnBind(theKey:K):boolean", "Find(theKey:K):V",
+       "ChangeFind(theKey:K):V"}}},
+    {"NCollection_IndexedDataMap",
+     {"bind_indexed_data_map",
+      {"K", "V"},
+      {"Add(theKey:K,theItem:V):integer", "Contains(theKey:K):boolean",
+       "Substitute(theIndex:integer,theKey:K,theItem:V)",
+       "Swap(theIndex1:integer,theIndex2:integer)", "RemoveLast()",
+       "RemoveFromIndex(theIndex:integer)", "RemoveKey(theKey:K)",
+       "FindKey(theIndex:integer):K", "FindFromIndex(theIndex:integer):V",
+       "ChangeFromIndex(theIndex:integer):V", "FindIndex(theKey:K):integer",
+       "FindFromKey(theKey:K):V", "ChangeFromKey(theKey:K):V"}}},
+    {"NCollection_DoubleMap",
+     {"bind_double_map",
+      {"K1", "K2"},
+      {"Bind(theKey1:K1,theKey2:K2)", "AreBound(theKey1:K1,theKey2:K2):boolean",
+       "IsBound1(theKey1:K1):boolean", "IsBound2(theKey2:K2):boolean",
+       "UnBind1(theKey1:K1):boolean", "UnBind2(theKey2:K2):boolean",
+       "Find1(theKey1:K1):K2", "Find2(theKey2:K2):K1"}}},
+};
+
+bool Binder_Module::generateCollection(const Binder_Cursor &theTypeDef) {
+  Binder_Type aType = theTypeDef.UnderlyingTypedefType();
+  auto anIter = COLLECTIONS.find(aType.GetDeclaration().Spelling());
+
+  if (anIter == COLLECTIONS.end())
+    return false;
+
+  const Binder_Collection &aColl = anIter->second;
+  std::string aClassSpelling = theTypeDef.Spelling();
+  CursorInfo info{false, theTypeDef, aClassSpelling, {}};
+
+  std::vector<std::string> aMethods = {
+      "Extent():integer", "Size():integer", "IsEmpty():boolean", "Clear()",
+      "Exchange(theOther:M)"};
+  aMethods.insert(aMethods.end(), aColl.methods.cbegin(), aColl.methods.cend());
+
+  // The shared binder registers all of them and the copy: a black listed
+  // one takes the generic path, which checks each member.
+  if (Binder_Util_Contains(binder_config.myBlackListCopyable, aClassSpelling))
+    return false;
+
+  for (const std::string &aMethod : aMethods) {
+    std::string aName = aMethod.substr(0, aMethod.find('('));
+
+    if (Binder_Util_Contains(binder_config.myBlackListMethodByName, aName) ||
+        Binder_Util_Contains(binder_config.myBlackListMethod,
+                             aClassSpelling + "::" + aName))
+      return false;
+  }
+
+  std::cout << "Binding collection: " << aClassSpelling << '\n';
+  useDecl(theTypeDef);
+  myBlock.raw = true;
+  myBlock.localIncludes.insert("lcollection.h");
+
+  std::unordered_map<std::string, std::string> aLuaTypes{{"M", aClassSpelling}};
+  mySourceStream << "luaocct::" << aColl.binder << '<' << aClassSpelling;
+
+  for (std::size_t i = 0; i < aColl.args.size(); ++i) {
+    Binder_Type anArg = aType.GetTemplateArgumentAsType(i);
+    useType(anArg);
+    aLuaTypes[aColl.args[i]] = luaTypeMap(anArg, info);
+    mySourceStream << ',' << anArg.Spelling();
+  }
+
+  mySourceStream << ">(luaocct::module_namespace(L,\"" << myName << "\"),\""
+                 << aClassSpelling << "\");\n\n";
+
+  auto aLuaType = [&](const std::string &theType) {
+    auto aLuaIter = aLuaTypes.find(theType);
+    return aLuaIter == aLuaTypes.end() ? theType : aLuaIter->second;
+  };
+
+  myMetaStream << "---@class " << aClassSpelling << '\n';
+  myMetaStream << "---@overload fun():" << aClassSpelling << '\n';
+  myMetaStream << "---@overload fun(theOther:" << aClassSpelling
+               << "):" << aClassSpelling << '\n';
+  myMetaStream << "LuaOCCT." << myName << '.' << aClassSpelling << " = {}\n\n";
+
+  for (const std::string &aMethod : aMethods) {
+    std::size_t anOpen = aMethod.find('(');
+    std::size_t aClose = aMethod.find(')');
+    std::string aParams = aMethod.substr(anOpen + 1, aClose - anOpen - 1);
+    std::vector<std::string> aNames{};
+
+    std::istringstream aParamStream{aParams};
+    for (std::string aParam{}; std::getline(aParamStream, aParam, ',');) {
+      std::size_t aColon = aParam.find(':');
+      aNames.push_back(aParam.substr(0, aColon));
+      myMetaStream << "---@param " << aNames.back() << ' '
+                   << aLuaType(aParam.substr(aColon + 1)) << '\n';
+    }
+
+    if (aClose + 1 < aMethod.size()) {
+      myMetaStream << "---@return " << aLuaType(aMethod.substr(aClose + 2))
+                   << '\n';
+    }
+
+    myMetaStream << "function LuaOCCT." << myName << '.' << aClassSpelling
+                 << ':' << aMethod.substr(0, anOpen) << '('
+                 << Binder_Util_Join(
+                        aNames.cbegin(), aNames.cend(),
+                        [](const std::string &theName) { return theName; })
+                 << ") end\n\n";
+  }
 
   return true;
 }
@@ -863,8 +1901,39 @@ bool Binder_Module::Init() {
   myExportName = myExportDir + "/l" + myName;
   myPrefix = myName + "_";
 
-  mySourceStream = std::ofstream(myExportName + ".cpp");
-  myEnumStream = std::ofstream(myExportDir + "/lenums.h", std::ios::app);
+  auto aShards = binder_config.myShards.find(myName);
+  myNbShards = aShards == binder_config.myShards.end()
+                   ? 1
+                   : std::max(1, aShards->second);
+
+  // Remove the sources of a previous run, the shard count may have changed:
+  // l<Mod>.cpp and l<Mod>_<k>.cpp, the module name matched literally.
+  const std::string aStem = "l" + myName;
+  for (const auto &anEntry : std::filesystem::directory_iterator(myExportDir)) {
+    std::string aName = anEntry.path().stem().string();
+
+    if (anEntry.path().extension() != ".cpp" ||
+        !Binder_Util_StartsWith(aName, aStem))
+      continue;
+
+    std::string aShard = aName.substr(aStem.size());
+
+    if (aShard.empty() ||
+        (aShard.size() > 1 && aShard[0] == '_' &&
+         aShard.find_first_not_of("0123456789", 1) == std::string::npos))
+      std::filesystem::remove(anEntry.path());
+  }
+
+  myBlocks.clear();
+  myNbHelpers = 0;
+  myNbPruned = 0;
+  myNbDispatchers = 0;
+  myNbFastPaths = 0;
+  myNbTables = 0;
+  myNbEnumTables = 0;
+  myNbEmplaced = 0;
+  myEnumStream.str("");
+  myEnumIncludes.clear();
   myMetaStream = std::ofstream(myExportDir + "/_meta/" + myName + ".lua");
 
   return true;
@@ -873,13 +1942,6 @@ bool Binder_Module::Init() {
 bool Binder_Module::Generate() {
   Binder_Cursor aCursor = clang_getTranslationUnitCursor(myTransUnit);
 
-  mySourceStream << "/* This file is generated, do not edit. */\n\n";
-  mySourceStream << "#include \"lenums.h\"\n\n";
-  mySourceStream << "\nvoid luaocct_init_" << myName << "(lua_State *L) {\n";
-  mySourceStream << "luabridge::getGlobalNamespace(L)\n";
-  mySourceStream << ".beginNamespace(\"LuaOCCT\")\n";
-  mySourceStream << ".beginNamespace(\"" << myName << "\")\n\n";
-
   myMetaStream << "---@meta _\n";
   myMetaStream << "-- This file is generated, do not edit.\n";
   myMetaStream << "error('Cannot require a meta file')\n\n";
@@ -891,7 +1953,9 @@ bool Binder_Module::Generate() {
   for (const auto &anEnum : anEnums) {
     std::string anEnumSpelling = anEnum.Spelling();
 
-    if (!Binder_Util_StartsWith(anEnumSpelling, myPrefix))
+    // Its luabridge::Stack goes to the enum header of the module of its
+    // header, see useDecl.
+    if (myParent->FileModule(anEnum.File()) != myName)
       continue;
 
     if (anEnumSpelling.empty())
@@ -903,8 +1967,9 @@ bool Binder_Module::Generate() {
     if (!generateEnumCast(anEnum))
       continue;
 
-    if (!generateEnumValue(anEnum))
-      continue;
+    beginBlock(anEnumSpelling);
+    generateEnumValue(anEnum);
+    endBlock();
   }
 
   // Bind structs.
@@ -918,7 +1983,12 @@ bool Binder_Module::Generate() {
         aStructSpelling != myName)
       continue;
 
+    if (!myParent->ClassIndex().IsReachable(aStructSpelling))
+      continue;
+
+    beginBlock(aStructSpelling);
     generateStruct(aStruct, myParent);
+    endBlock();
   }
 
   // Bind typedefs.
@@ -935,6 +2005,9 @@ bool Binder_Module::Generate() {
     if (Binder_Util_Contains(binder_config.myBlackListClass, aClassSpelling))
       continue;
 
+    if (!myParent->ClassIndex().IsReachable(aClassSpelling))
+      continue;
+
     Binder_Cursor aTDDecl = aTypeDef.UnderlyingTypedefType().GetDeclaration();
     std::string aTDDeclSpelling = aTDDecl.Spelling();
 
@@ -942,7 +2015,10 @@ bool Binder_Module::Generate() {
         Binder_Util_Contains(binder_config.myTemplateClass, aTDDeclSpelling)) {
       std::cout << "typedef: " << aTDDeclSpelling << ' ' << aClassSpelling
                 << '\n';
-      generateClass(aTypeDef, myParent);
+      beginBlock(aClassSpelling);
+      if (!generateCollection(aTypeDef))
+        generateClass(aTypeDef, myParent);
+      endBlock();
     }
   }
 
@@ -969,6 +2045,9 @@ bool Binder_Module::Generate() {
     if (Binder_Util_Contains(binder_config.myBlackListClass, aClassSpelling))
       continue;
 
+    if (!myParent->ClassIndex().IsReachable(aClassSpelling))
+      continue;
+
     // Handle forward declaration.
     // To make sure the binding order is along the inheritance tree.
 
@@ -987,11 +2066,169 @@ bool Binder_Module::Generate() {
     if (!myParent->AddVisitedClass(aClassSpelling))
       continue;
 
+    beginBlock(aClassSpelling);
     generateClass(aClass, myParent);
+    endBlock();
   }
 
-  mySourceStream << ".endNamespace()\n.endNamespace();\n}\n";
-  std::cout << "Module exported: " << myExportName << '\n' << std::endl;
+  exportEnums();
+  std::cout << "Shared helpers: " << myNbHelpers
+            << " bindings to lsupport.h templates, sized by module in the "
+               "size report\n";
+  std::cout << "Dispatchers: " << myNbDispatchers << " overload groups\n";
+  std::cout << "Fast paths: " << myNbFastPaths << " numeric methods\n";
+  std::cout << "Function tables: " << myNbTables << " static classes\n";
+  std::cout << "Emplaced: " << myNbEmplaced
+            << " class results constructed in their userdata\n";
+  std::cout << "Enum tables: " << myNbEnumTables
+            << " enums filled with integer fields\n";
+
+  if (binder_config.myPruneSignatures)
+    std::cout << "Pruned: " << myNbPruned
+              << " signatures using unregistered types\n";
+
+  if (myNbShards == 1) {
+    std::vector<std::size_t> anAll(myBlocks.size());
+    for (std::size_t i = 0; i < anAll.size(); ++i)
+      anAll[i] = i;
+
+    exportSource(myExportName + ".cpp", "luaocct_init_" + myName, anAll);
+
+    if (binder_config.myLazyClasses && !binder_config.myPlugins)
+      exportLazyEntry(myExportName + ".cpp");
+
+    std::cout << "Module exported: " << myExportName << '\n' << std::endl;
+    return true;
+  }
+
+  std::vector<std::vector<std::size_t>> aShards =
+      planShards(myBlocks, myNbShards);
+
+  for (int k = 0; k < myNbShards; ++k) {
+    std::string aShard = myName + "_" + std::to_string(k);
+    exportSource(myExportDir + "/l" + aShard + ".cpp", "luaocct_init_" + aShard,
+                 aShards[k]);
+  }
+
+  if (binder_config.myLazyClasses && !binder_config.myPlugins) {
+    exportLazyEntry(myExportName + "_0.cpp");
+    std::cout << "Module exported: " << myExportName << " (" << myNbShards
+              << " shards, lazy)\n"
+              << std::endl;
+    return true;
+  }
+
+  // The module entry registers the shards in order.
+  std::ofstream aStream{myExportName + "_0.cpp", std::ios::app};
+  aStream << '\n';
+
+  for (int k = 1; k < myNbShards; ++k) {
+    aStream << "extern void luaocct_init_" << myName << '_' << k
+            << "(lua_State *L);\n";
+  }
+
+  aStream << "\nvoid luaocct_init_" << myName << "(lua_State *L) {\n";
+
+  for (int k = 0; k < myNbShards; ++k) {
+    aStream << "\tluaocct_init_" << myName << '_' << k << "(L);\n";
+  }
+
+  aStream << "}\n";
+  std::cout << "Module exported: " << myExportName << " (" << myNbShards
+            << " shards)\n"
+            << std::endl;
+
+  return true;
+}
+
+/// The declarations spelled by |theType|, e.g. `handle` and `Geom_Curve` of
+/// `const Handle(Geom_Curve) &`.
+static void typeNames(const Binder_Type &theType,
+                      std::vector<std::string> &theNames) {
+  Binder_Type aType = theType.IsPointerLike() ? theType.GetPointee() : theType;
+  Binder_Cursor aDecl = aType.GetDeclaration();
+
+  if (aDecl.IsNull())
+    return;
+
+  theNames.push_back(aDecl.Spelling());
+
+  for (int i = 0; i < aType.GetNumTempalteArguments(); ++i)
+    typeNames(aType.GetTemplateArgumentAsType(i), theNames);
+}
+
+bool Binder_Module::Index(Binder_Index &theIndex) const {
+  Binder_Cursor aCursor = clang_getTranslationUnitCursor(myTransUnit);
+  std::string aPrefix = myName + "_";
+
+  std::vector<Binder_Cursor> aDecls =
+      aCursor.GetChildrenOfKind(CXCursor_StructDecl);
+  std::vector<Binder_Cursor> aClasses =
+      aCursor.GetChildrenOfKind(CXCursor_ClassDecl);
+  std::vector<Binder_Cursor> aTypeDefs =
+      aCursor.GetChildrenOfKind(CXCursor_TypedefDecl);
+  aDecls.insert(aDecls.end(), aClasses.cbegin(), aClasses.cend());
+  aDecls.insert(aDecls.end(), aTypeDefs.cbegin(), aTypeDefs.cend());
+
+  for (const auto &aDecl : aDecls) {
+    std::string aSpelling = aDecl.Spelling();
+    std::vector<std::string> aNames{};
+
+    if (!Binder_Util_StartsWith(aSpelling, aPrefix) && aSpelling != myName)
+      continue;
+
+    // The classes bound by Generate().
+    if (Binder_Util_Contains(binder_config.myBlackListClass, aSpelling))
+      continue;
+
+    if (aDecl.Kind() == CXCursor_ClassDecl &&
+        (Binder_Util_StrContains(aSpelling, "Sequence") ||
+         Binder_Util_StrContains(aSpelling, "Array") ||
+         Binder_Util_StrContains(aSpelling, "List")))
+      continue;
+
+    // e.g. the key and item types of a map.
+    if (aDecl.IsTypeDef()) {
+      Binder_Type aType = aDecl.UnderlyingTypedefType();
+      Binder_Cursor aTmpl = aType.GetDeclaration();
+
+      if (!aTmpl.IsClass() || !Binder_Util_Contains(
+                                  binder_config.myTemplateClass,
+                                  aTmpl.Spelling()))
+        continue;
+
+      typeNames(aType, aNames);
+    } else if (!aDecl.GetChildren().empty()) {
+      for (const auto &aBase : aDecl.Bases())
+        theIndex.AddBase(aSpelling, aBase.GetDefinition().Spelling());
+
+      for (const auto &aCtor : aDecl.Ctors(true)) {
+        for (const auto &aParam : aCtor.Parameters())
+          typeNames(aParam.Type(), aNames);
+      }
+
+      for (const auto &aField : aDecl.GetChildrenOfKind(CXCursor_FieldDecl))
+        typeNames(aField.Type(), aNames);
+
+      for (const auto &aMethod : aDecl.Methods()) {
+        std::vector<std::string> aMethodNames{};
+        typeNames(aMethod.ReturnType(), aMethodNames);
+
+        for (const auto &aParam : aMethod.Parameters())
+          typeNames(aParam.Type(), aMethodNames);
+
+        for (const auto &aName : aMethodNames)
+          theIndex.AddUse(aSpelling, aMethod.Spelling(), aName);
+      }
+    } else {
+      continue;
+    }
+
+    theIndex.AddClass(aSpelling);
+
+    for (const auto &aName : aNames)
+      theIndex.AddUse(aSpelling, "", aName);
+  }
 
   return true;
 }
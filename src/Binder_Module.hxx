@@ -2,6 +2,8 @@
 #define _LuaOCCT_Binder_Module_HeaderFile
 
 #include <fstream>
+#include <set>
+#include <sstream>
 #include <stack>
 #include <string>
 #include <unordered_map>
@@ -10,6 +12,7 @@
 #include "Binder_Cursor.hxx"
 
 class Binder_Generator;
+class Binder_Index;
 
 class Binder_Module {
 public:
@@ -17,6 +20,8 @@ public:
 
   ~Binder_Module();
 
+  const std::string &Name() const { return myName; }
+
   bool Init();
 
   bool Generate();
@@ -27,12 +32,30 @@ public:
 
   bool Parse();
 
+  bool Index(Binder_Index &theIndex) const;
+
 public:
   struct CursorInfo {
     bool isTemplate;
     Binder_Cursor cursor;
     std::string spelling;
     std::unordered_map<std::string, std::string> argMap;
+    bool isTable = false; // a namespace of static functions, see generateClass
+  };
+
+  /// A self-contained piece of the registration chain, e.g. a class from
+  /// `.beginClass` to `.endClass()`. A raw block is a C++ statement instead.
+  struct Block {
+    std::string name{};
+    std::string code{};
+    std::vector<std::string> bases{};
+    // The bases as lazy_entry names: `Base`, or `Mod.Base` of another module.
+    std::vector<std::string> lazyBases{};
+    std::set<std::string> uses{}; // `Class`, or `Mod.Class` of another module
+    std::set<std::string> includes{};
+    std::set<std::string> localIncludes{};
+    int classId = -1; // see Binder_Generator::AddClassId
+    bool raw = false;
   };
 
 private:
@@ -48,6 +71,17 @@ private:
                              const CursorInfo &theInfo,
                              bool theIsOverload = false);
 
+  std::string generateInOut(const Binder_Cursor &theMethod,
+                            const std::vector<Binder_Cursor> &theIn,
+                            const std::vector<Binder_Cursor> &theOut,
+                            const std::string &theMeta, bool theGenMeta,
+                            const CursorInfo &theInfo);
+
+  std::string generateDispatcher(const Binder_Cursor &theClass,
+                                 const std::vector<Binder_Cursor> &theMethods,
+                                 const std::string &theSuffix,
+                                 const CursorInfo &theInfo);
+
   bool generateMethods(const Binder_Cursor &theClass,
                        const CursorInfo &theInfo);
 
@@ -60,6 +94,36 @@ private:
   bool generateClass(const Binder_Cursor &theClass,
                      const Binder_Generator *theParent);
 
+  bool generateCollection(const Binder_Cursor &theTypeDef);
+
+  void useDecl(const Binder_Cursor &theDecl);
+
+  void useType(const Binder_Type &theType);
+
+  void useInstance(const Binder_Cursor &theDecl, bool theIsHandle);
+
+  std::string unregisteredType(const Binder_Type &theType) const;
+
+  /// Whether |theType| is a class bound by value, e.g. a gp_Pnt, not a
+  /// handle.
+  bool isBoundClass(const Binder_Type &theType) const;
+
+  bool isCallable(const Binder_Cursor &theFunc, const std::string &theClass);
+
+  void beginBlock(const std::string &theName);
+
+  void endBlock();
+
+  bool exportSource(const std::string &thePath, const std::string &theFunc,
+                    const std::vector<std::size_t> &theBlocks) const;
+
+  bool exportEnums() const;
+
+  bool exportLazyEntry(const std::string &thePath) const;
+
+  std::size_t addRanges(const std::string &theSource, std::size_t theLine,
+                        const Block &theBlock) const;
+
   void dispose();
 
 private:
@@ -74,9 +138,21 @@ private:
   CXIndex myIndex;
   CXTranslationUnit myTransUnit;
 
+  int myNbShards;
+  int myNbHelpers;
+  int myNbPruned;
+  int myNbDispatchers;
+  int myNbFastPaths;
+  int myNbTables;
+  int myNbEnumTables;
+  int myNbEmplaced;
+  Block myBlock;
+  std::vector<Block> myBlocks;
+
   std::ofstream myHeaderStream;
-  std::ofstream mySourceStream;
-  std::ofstream myEnumStream;
+  std::ostringstream mySourceStream;
+  std::ostringstream myEnumStream;
+  std::set<std::string> myEnumIncludes;
   std::ofstream myMetaStream;
 };
 
@@ -0,0 +1,1435 @@
+#include "Binder_Support.hxx"
+
+const char *const Binder_Support_Collection =
+    R"cpp(/* This file is generated, do not edit. */
+
+#ifndef _LuaOCCT_lcollection_HeaderFile
+#define _LuaOCCT_lcollection_HeaderFile
+
+#include <luaocct_bind/lbind.h>
+
+namespace luaocct {
+
+/// LuaOCCT.<theModule>
+inline luabridge::Namespace module_namespace(lua_State *L,
+                                             const char *theModule) {
+  return luabridge::getGlobalNamespace(L)
+      .beginNamespace("LuaOCCT")
+      .beginNamespace(theModule);
+}
+
+/// Members shared by all the hashed maps.
+template <class M>
+luabridge::Namespace::Class<M>
+bind_base_map(luabridge::Namespace::Class<M> theClass) {
+  return theClass.template addConstructor<void(), void(const M &)>()
+      .addFunction("Extent", +[](const M &theSelf) { return theSelf.Extent(); })
+      .addFunction("Size", +[](const M &theSelf) { return theSelf.Size(); })
+      .addFunction("IsEmpty",
+                   +[](const M &theSelf) { return theSelf.IsEmpty(); })
+      .addFunction("Clear", +[](M &theSelf) { theSelf.Clear(); })
+      .addFunction("Exchange", +[](M &theSelf, M &theOther) {
+        theSelf.Exchange(theOther);
+      });
+}
+
+/// NCollection_Map<K>
+template <class M, class K>
+void bind_map(luabridge::Namespace theNs, const char *theName) {
+  bind_base_map<M>(theNs.beginClass<M>(theName))
+      .addFunction("Add", +[](M &theSelf, const K &theKey) {
+        return theSelf.Add(theKey);
+      })
+      .addFunction("Contains", +[](const M &theSelf, const K &theKey) {
+        return theSelf.Contains(theKey);
+      })
+      .addFunction("Remove", +[](M &theSelf, const K &theKey) {
+        return theSelf.Remove(theKey);
+      })
+      .addFunction("Unite", +[](M &theSelf, const M &theOther) {
+        return theSelf.Unite(theOther);
+      })
+      .addFunction("Intersect", +[](M &theSelf, const M &theOther) {
+        return theSelf.Intersect(theOther);
+      })
+      .addFunction("Subtract", +[](M &theSelf, const M &theOther) {
+        return theSelf.Subtract(theOther);
+      })
+      .addFunction("Differ", +[](M &theSelf, const M &theOther) {
+        return theSelf.Differ(theOther);
+      })
+      .endClass();
+}
+
+/// NCollection_IndexedMap<K>
+template <class M, class K>
+void bind_indexed_map(luabridge::Namespace theNs, const char *theName) {
+  bind_base_map<M>(theNs.beginClass<M>(theName))
+      .addFunction("Add", +[](M &theSelf, const K &theKey) {
+        return theSelf.Add(theKey);
+      })
+      .addFunction("Contains", +[](const M &theSelf, const K &theKey) {
+        return theSelf.Contains(theKey);
+      })
+      .addFunction("Substitute",
+                   +[](M &theSelf, int theIndex, const K &theKey) {
+                     theSelf.Substitute(theIndex, theKey);
+                   })
+      .addFunction("Swap", +[](M &theSelf, int theIndex1, int theIndex2) {
+        theSelf.Swap(theIndex1, theIndex2);
+      })
+      .addFunction("RemoveLast", +[](M &theSelf) { theSelf.RemoveLast(); })
+      .addFunction("RemoveFromIndex", +[](M &theSelf, int theIndex) {
+        theSelf.RemoveFromIndex(theIndex);
+      })
+      .addFunction("RemoveKey", +[](M &theSelf, const K &theKey) {
+        return theSelf.RemoveKey(theKey);
+      })
+      .addFunction("FindKey", +[](const M &theSelf, int theIndex) -> K {
+        return theSelf.FindKey(theIndex);
+      })
+      .addFunction("FindIndex", +[](const M &theSelf, const K &theKey) {
+        return theSelf.FindIndex(theKey);
+      })
+      .endClass();
+}
+
+/// NCollection_DataMap<K, V>
+template <class M, class K, class V>
+void bind_data_map(luabridge::Namespace theNs, const char *theName) {
+  bind_base_map<M>(theNs.beginClass<M>(theName))
+      .addFunction("Bind", +[](M &theSelf, const K &theKey, const V &theItem) {
+        return theSelf.Bind(theKey, theItem);
+      })
+      .addFunction("IsBound", +[](const M &theSelf, const K &theKey) {
+        return theSelf.IsBound(theKey);
+      })
+      .addFunction("UnBind", +[](M &theSelf, const K &theKey) {
+        return theSelf.UnBind(theKey);
+      })
+      .addFunction("Find", +[](const M &theSelf, const K &theKey) -> V {
+        return theSelf.Find(theKey);
+      })
+      .addFunction("ChangeFind", +[](M &theSelf, const K &theKey) -> V & {
+        return theSelf.ChangeFind(theKey);
+      })
+      .endClass();
+}
+
+/// NCollection_IndexedDataMap<K, V>
+template <class M, class K, class V>
+void bind_indexed_data_map(luabridge::Namespace theNs, const char *theName) {
+  bind_base_map<M>(theNs.beginClass<M>(theName))
+      .addFunction("Add", +[](M &theSelf, const K &theKey, const V &theItem) {
+        return theSelf.Add(theKey, theItem);
+      })
+      .addFunction("Contains", +[](const M &theSelf, const K &theKey) {
+        return theSelf.Contains(theKey);
+      })
+      .addFunction("Substitute", +[](M &theSelf, int theIndex, const K &theKey,
+                                     const V &theItem) {
+        theSelf.Substitute(theIndex, theKey, theItem);
+      })
+      .addFunction("Swap", +[](M &theSelf, int theIndex1, int theIndex2) {
+        theSelf.Swap(theIndex1, theIndex2);
+      })
+      .addFunction("RemoveLast", +[](M &theSelf) { theSelf.RemoveLast(); })
+      .addFunction("RemoveFromIndex", +[](M &theSelf, int theIndex) {
+        theSelf.RemoveFromIndex(theIndex);
+      })
+      .addFunction("RemoveKey", +[](M &theSelf, const K &theKey) {
+        theSelf.RemoveKey(theKey);
+      })
+      .addFunction("FindKey", +[](const M &theSelf, int theIndex) -> K {
+        return theSelf.FindKey(theIndex);
+      })
+      .addFunction("FindFromIndex", +[](const M &theSelf, int theIndex) -> V {
+        return theSelf.FindFromIndex(theIndex);
+      })
+      .addFunction("ChangeFromIndex", +[](M &theSelf, int theIndex) -> V & {
+        return theSelf.ChangeFromIndex(theIndex);
+      })
+      .addFunction("FindIndex", +[](const M &theSelf, const K &theKey) {
+        return theSelf.FindIndex(theKey);
+      })
+      .addFunction("FindFromKey", +[](const M &theSelf, const K &theKey) -> V {
+        return theSelf.FindFromKey(theKey);
+      })
+      .addFunction("ChangeFromKey", +[](M &theSelf, const K &theKey) -> V & {
+        return theSelf.ChangeFromKey(theKey);
+      })
+      .endClass();
+}
+
+/// NCollection_DoubleMap<K1, K2>
+template <class M, class K1, class K2>
+void bind_double_map(luabridge::Namespace theNs, const char *theName) {
+  bind_base_map<M>(theNs.beginClass<M>(theName))
+      .addFunction("Bind",
+                   +[](M &theSelf, const K1 &theKey1, const K2 &theKey2) {
+                     theSelf.Bind(theKey1, theKey2);
+                   })
+      .addFunction("AreBound",
+                   +[](const M &theSelf, const K1 &theKey1, const K2 &theKey2) {
+                     return theSelf.AreBound(theKey1, theKey2);
+                   })
+      .addFunction("IsBound1", +[](const M &theSelf, const K1 &theKey1) {
+        return theSelf.IsBound1(theKey1);
+      })
+      .addFunction("IsBound2", +[](const M &theSelf, const K2 &theKey2) {
+        return theSelf.IsBound2(theKey2);
+      })
+      .addFunction("UnBind1", +[](M &theSelf, const K1 &theKey1) {
+        return theSelf.UnBind1(theKey1);
+      })
+      .addFunction("UnBind2", +[](M &theSelf, const K2 &theKey2) {
+        return theSelf.UnBind2(theKey2);
+      })
+      .addFunction("Find1", +[](const M &theSelf, const K1 &theKey1) -> K2 {
+        return theSelf.Find1(theKey1);
+      })
+      .addFunction("Find2", +[](const M &theSelf, const K2 &theKey2) -> K1 {
+        return theSelf.Find2(theKey2);
+      })
+      .endClass();
+}
+
+} // namespace luaocct
+
+#endif
+)cpp";
+
+const char *const Binder_Support_Helpers =
+    R"cpp(/* This file is generated, do not edit. */
+
+#ifndef _LuaOCCT_lsupport_HeaderFile
+#define _LuaOCCT_lsupport_HeaderFile
+
+#include <luaocct_bind/lbind.h>
+
+#include <Standard_Failure.hxx>
+
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace luaocct {
+
+/// An error of a wrapper, raised by protect() as a Lua error.
+[[noreturn]] inline void fail(const std::string &theMessage) {
+  throw std::runtime_error(theMessage);
+}
+
+/// Runs |theBody| of a lua_CFunction. A Standard_Failure or std::exception
+/// is raised as a Lua error once the C++ locals are destroyed, neither
+/// unwound through the C frames of Lua nor skipped by longjmp. The errors of
+/// Lua itself go through.
+template <class B> int protect(lua_State *L, B theBody) {
+  char aMessage[256] = {};
+
+  try {
+    return theBody();
+  } catch (const Standard_Failure &theFailure) {
+    std::snprintf(aMessage, sizeof(aMessage), "%s",
+                  theFailure.GetMessageString());
+  } catch (const std::exception &theError) {
+    std::snprintf(aMessage, sizeof(aMessage), "%s", theError.what());
+  }
+
+  return luaL_error(L, "LuaOCCT: %s", aMessage);
+}
+
+/// DownCast from Standard_Transient.
+template <class T>
+opencascade::handle<T>
+downcast(const opencascade::handle<Standard_Transient> &theHandle) {
+  return opencascade::handle<T>::DownCast(theHandle);
+}
+
+/// A constant of an enum table.
+struct enum_field {
+  const char *name;
+  lua_Integer value;
+};
+
+/// __newindex of the enum tables.
+inline int enum_newindex(lua_State *L) {
+  return luaL_error(L, "LuaOCCT: cannot assign %s of an enum",
+                    luaL_tolstring(L, 2, nullptr));
+}
+
+/// The iterator of enum_pairs, next() on the fields table.
+inline int enum_next(lua_State *L) {
+  lua_settop(L, 2);
+
+  return lua_next(L, 1) ? 2 : 0;
+}
+
+/// __pairs of the enum tables, iterating their fields table.
+inline int enum_pairs(lua_State *L) {
+  lua_pushcfunction(L, &enum_next);
+  lua_getmetatable(L, 1);
+  lua_getfield(L, -1, "__index");
+  lua_remove(L, -2);
+  lua_pushnil(L);
+
+  return 3;
+}
+
+/// LuaOCCT.<theModule>.<theEnum>, an empty proxy of a plain table of
+/// |theFields| sized once: a read goes to it through a table __index, no
+/// getter is called, any write raises an error, and pairs() iterates the
+/// fields.
+template <std::size_t N>
+void enum_table(lua_State *L, const char *theModule, const char *theEnum,
+                const enum_field (&theFields)[N]) {
+  luabridge::getGlobalNamespace(L)
+      .beginNamespace("LuaOCCT")
+      .beginNamespace(theModule)
+      .endNamespace()
+      .endNamespace();
+
+  lua_getglobal(L, "LuaOCCT");
+  lua_pushstring(L, theModule);
+  lua_rawget(L, -2);
+  lua_pushstring(L, theEnum);
+  lua_createtable(L, 0, 0);
+  lua_createtable(L, 0, 4);
+  lua_createtable(L, 0, static_cast<int>(N));
+
+  for (const auto &aField : theFields) {
+    lua_pushinteger(L, aField.value);
+    lua_setfield(L, -2, aField.name);
+  }
+
+  lua_setfield(L, -2, "__index");
+  lua_pushcfunction(L, &enum_newindex);
+  lua_setfield(L, -2, "__newindex");
+  lua_pushcfunction(L, &enum_pairs);
+  lua_setfield(L, -2, "__pairs");
+  lua_pushboolean(L, 0);
+  lua_setfield(L, -2, "__metatable");
+  lua_setmetatable(L, -2);
+  lua_rawset(L, -3);
+  lua_pop(L, 2);
+}
+
+/// Lua operators, |S| is the (const) class of self.
+template <class S> auto op_unm(S &theSelf) -> decltype(-theSelf) {
+  return -theSelf;
+}
+
+template <class S, class O>
+auto op_add(S &theSelf, O theOther) -> decltype(theSelf + theOther) {
+  return theSelf + theOther;
+}
+
+template <class S, class O>
+auto op_sub(S &theSelf, O theOther) -> decltype(theSelf - theOther) {
+  return theSelf - theOther;
+}
+
+template <class S, class O>
+auto op_mul(S &theSelf, O theOther) -> decltype(theSelf * theOther) {
+  return theSelf * theOther;
+}
+
+template <class S, class O>
+auto op_div(S &theSelf, O theOther) -> decltype(theSelf / theOther) {
+  return theSelf / theOther;
+}
+
+template <class S, class O>
+auto op_eq(S &theSelf, O theOther) -> decltype(theSelf == theOther) {
+  return theSelf == theOther;
+}
+
+/// Copies the entries of the table on top missing from the table below,
+/// except the metamethods.
+inline void flatten_entries(lua_State *L) {
+  lua_pushnil(L);
+
+  while (lua_next(L, -2) != 0) {
+    if (lua_type(L, -2) == LUA_TSTRING &&
+        std::strncmp(lua_tostring(L, -2), "__", 2) != 0) {
+      lua_pushvalue(L, -2);
+      lua_rawget(L, -5);
+      bool isMissing = lua_isnil(L, -1);
+      lua_pop(L, 1);
+
+      if (isMissing) {
+        lua_pushvalue(L, -2);
+        lua_pushvalue(L, -2);
+        lua_rawset(L, -6);
+      }
+    }
+
+    lua_pop(L, 1);
+  }
+}
+
+/// Flattens the metatable of |theDerived| with the one of |theBase|, by
+/// registry key: the functions, then the properties.
+inline void flatten_table(lua_State *L, const void *theDerived,
+                          const void *theBase) {
+  lua_rawgetp(L, LUA_REGISTRYINDEX, theDerived);
+  lua_rawgetp(L, LUA_REGISTRYINDEX, theBase);
+
+  if (lua_istable(L, -2) && lua_istable(L, -1)) {
+    flatten_entries(L);
+
+    for (const void *aKey : {luabridge::detail::getPropgetKey(),
+                             luabridge::detail::getPropsetKey()}) {
+      lua_rawgetp(L, -2, aKey);
+      lua_rawgetp(L, -2, aKey);
+
+      if (lua_istable(L, -2) && lua_istable(L, -1))
+        flatten_entries(L);
+
+      lua_pop(L, 2);
+    }
+  }
+
+  lua_pop(L, 2);
+}
+
+/// Copies the members |C| inherits from |B|, once both are registered, so a
+/// lookup ends at the metatable of the object. The members still check self
+/// is a |B|, which a |C| is.
+template <class C, class B> void flatten(lua_State *L) {
+  flatten_table(L, luabridge::detail::getClassRegistryKey<C>(),
+                luabridge::detail::getClassRegistryKey<B>());
+  flatten_table(L, luabridge::detail::getConstRegistryKey<C>(),
+                luabridge::detail::getConstRegistryKey<B>());
+}
+
+/// Class ids of lclasses.cpp: the displays of the ancestors, root first, and
+/// the depths of the classes, by id.
+extern const int *const class_displays[];
+extern const int class_depths[];
+
+/// The key of the class id in the metatables of the classes, of lclasses.cpp
+/// to be one for all the plugins.
+extern const char class_id_tag;
+
+inline const void *class_id_key() { return &class_id_tag; }
+
+/// The id of |T|, -1 unless registered with one.
+template <class T> int &class_id() {
+  static int anId = -1;
+  return anId;
+}
+
+/// Tags the class and const metatables of |T| with its id, ~id for const.
+template <class T> void set_class_id(lua_State *L, int theId) {
+  class_id<T>() = theId;
+
+  lua_rawgetp(L, LUA_REGISTRYINDEX,
+              luabridge::detail::getClassRegistryKey<T>());
+  lua_pushinteger(L, theId);
+  lua_rawsetp(L, -2, class_id_key());
+  lua_pop(L, 1);
+
+  lua_rawgetp(L, LUA_REGISTRYINDEX,
+              luabridge::detail::getConstRegistryKey<T>());
+  lua_pushinteger(L, ~theId);
+  lua_rawsetp(L, -2, class_id_key());
+  lua_pop(L, 1);
+}
+
+/// The |T| at |theIndex|, in constant time at any depth of its class:
+/// nullptr if not a |T|, or const unless |theCanBeConst|. Only for a |T|
+/// with an id. A class without one, e.g. of an extra module, is looked up by
+/// LuaBridge.
+template <class T>
+T *class_cast(lua_State *L, int theIndex, bool theCanBeConst) {
+  if (!lua_getmetatable(L, theIndex))
+    return nullptr;
+
+  lua_rawgetp(L, -1, class_id_key());
+  int isTagged = 0;
+  auto anId = static_cast<int>(lua_tointegerx(L, -1, &isTagged));
+  lua_pop(L, 2);
+
+  if (!isTagged) {
+    auto aPtr =
+        luabridge::detail::Userdata::get<T>(L, theIndex, theCanBeConst);
+    return aPtr ? *aPtr : nullptr;
+  }
+
+  if (anId < 0 && !theCanBeConst)
+    return nullptr;
+
+  anId = anId < 0 ? ~anId : anId;
+  int aTarget = class_id<T>();
+  int aDepth = class_depths[aTarget];
+
+  if (class_depths[anId] < aDepth || class_displays[anId][aDepth] != aTarget)
+    return nullptr;
+
+  // LuaBridge stores the object at the address of all its bases.
+  return static_cast<T *>(
+      static_cast<luabridge::detail::Userdata *>(lua_touserdata(L, theIndex))
+          ->getPointer());
+}
+
+template <class A> using arg_t = std::remove_cv_t<std::remove_reference_t<A>>;
+
+/// Whether |T| is a class registered by LuaBridge, i.e. pushed as its
+/// userdata.
+template <class T> bool is_registered(lua_State *L) {
+  lua_rawgetp(L, LUA_REGISTRYINDEX,
+              luabridge::detail::getClassRegistryKey<T>());
+  bool isRegistered = lua_istable(L, -1);
+  lua_pop(L, 1);
+
+  return isRegistered;
+}
+
+/// The object of the userdata at |theIndex|, by class id if it has one:
+/// nullptr if not a |P|, or const for a non-const |P|.
+template <class P> P *userdata_arg(lua_State *L, int theIndex) {
+  using T = std::remove_const_t<P>;
+
+  if (class_id<T>() >= 0)
+    return class_cast<T>(L, theIndex, std::is_const_v<P>);
+
+  auto aPtr = luabridge::get<P *>(L, theIndex);
+  return aPtr ? *aPtr : nullptr;
+}
+
+/// Whether the argument at |theIndex| can be passed as the parameter |A|:
+/// a non-const reference to a registered class takes no const object.
+template <class A> bool is_instance(lua_State *L, int theIndex) {
+  using T = arg_t<A>;
+
+  if constexpr (std::is_class_v<T>) {
+    using P = std::remove_reference_t<A>;
+    constexpr bool isNonConst =
+        std::is_lvalue_reference_v<A> && !std::is_const_v<P>;
+
+    if (class_id<T>() >= 0)
+      return class_cast<T>(L, theIndex, !isNonConst) != nullptr;
+
+    if (isNonConst && is_registered<T>(L))
+      return userdata_arg<P>(L, theIndex) != nullptr;
+  }
+
+  return luabridge::isInstance<T>(L, theIndex);
+}
+
+/// Overload dispatch: a generated lua_CFunction switches on lua_gettop, then
+/// calls the first candidate whose arguments match().
+template <class... A, std::size_t... I>
+bool match_at(lua_State *L, int theFirst, std::index_sequence<I...>) {
+  return (is_instance<A>(L, theFirst + static_cast<int>(I)) && ...);
+}
+
+/// Whether the arguments from |theFirst| are instances of |A|..., neither
+/// throwing nor formatting an error.
+template <class... A> bool match(lua_State *L, int theFirst) {
+  return match_at<A...>(L, theFirst, std::index_sequence_for<A...>{});
+}
+
+/// The class of self, const for a const method, and the arguments of |F|.
+template <class F> struct fn_traits;
+
+template <class R, class... A> struct fn_traits<R (*)(A...)> {
+  using self = void;
+  using args = std::tuple<A...>;
+};
+
+template <class R, class... A>
+struct fn_traits<R (*)(A...) noexcept> : fn_traits<R (*)(A...)> {};
+
+template <class R, class C, class... A> struct fn_traits<R (C::*)(A...)> {
+  using self = C;
+  using args = std::tuple<A...>;
+};
+
+template <class R, class C, class... A>
+struct fn_traits<R (C::*)(A...) noexcept> : fn_traits<R (C::*)(A...)> {};
+
+template <class R, class C, class... A>
+struct fn_traits<R (C::*)(A...) const> {
+  using self = const C;
+  using args = std::tuple<A...>;
+};
+
+template <class R, class C, class... A>
+struct fn_traits<R (C::*)(A...) const noexcept>
+    : fn_traits<R (C::*)(A...) const> {};
+
+/// Whether a |T| argument can be held by value, see arg_ref.
+template <class T>
+inline constexpr bool is_local_v =
+    !std::is_abstract_v<T> && std::is_copy_constructible_v<T>;
+
+/// An argument got by reference, like a luabridge::TypeResult: the object of
+/// its userdata, or a local of a type the Stack of LuaBridge converts, e.g.
+/// a handle or an array pushed as a table.
+template <class P> struct arg_ref {
+  using T = std::remove_const_t<P>;
+
+  P *ptr = nullptr;
+  std::optional<std::conditional_t<is_local_v<T>, T, char>> value{};
+
+  explicit operator bool() const {
+    return ptr != nullptr || value.has_value();
+  }
+
+  P *operator*() {
+    if constexpr (is_local_v<T>) {
+      if (value)
+        return &*value;
+    }
+
+    return ptr;
+  }
+};
+
+/// A registered class passed by reference is got by pointer, not copied.
+template <class A> auto get_arg(lua_State *L, int theIndex) {
+  using T = arg_t<A>;
+
+  if constexpr (std::is_lvalue_reference_v<A> && std::is_class_v<T>) {
+    using P = std::remove_reference_t<A>;
+    arg_ref<P> anArg{};
+
+    if constexpr (is_local_v<T>) {
+      if (!is_registered<T>(L)) {
+        auto aValue = luabridge::get<T>(L, theIndex);
+
+        if (aValue)
+          anArg.value.emplace(std::move(*aValue));
+
+        return anArg;
+      }
+    }
+
+    anArg.ptr = userdata_arg<P>(L, theIndex);
+    return anArg;
+  } else {
+    return luabridge::get<T>(L, theIndex);
+  }
+}
+
+template <class A, class V> decltype(auto) pass_arg(V &&theValue) {
+  if constexpr (std::is_lvalue_reference_v<A> && std::is_class_v<arg_t<A>>)
+    return *theValue;
+  else
+    return theValue;
+}
+
+/// A class result is constructed in its new userdata, guaranteed elision:
+/// neither copied nor moved, e.g. a TColgp_Array1OfPnt.
+template <class G> int push_result(lua_State *L, G theCall) {
+  using R = decltype(theCall());
+
+  if constexpr (std::is_void_v<R>) {
+    theCall();
+    return 0;
+  } else if constexpr (std::is_class_v<R>) {
+    if (is_registered<R>(L)) {
+      std::error_code anError{};
+      auto *aData = luabridge::detail::UserdataValue<R>::place(L, anError);
+
+      if (aData == nullptr)
+        fail(anError.message());
+
+      new (aData->getObject()) R(theCall());
+      aData->commit();
+      return 1;
+    }
+
+    auto aResult = luabridge::Stack<R>::push(L, theCall());
+
+    if (!aResult)
+      fail(aResult.message());
+
+    return 1;
+  } else {
+    auto aResult = luabridge::Stack<R>::push(L, theCall());
+
+    if (!aResult)
+      fail(aResult.message());
+
+    return 1;
+  }
+}
+
+/// A result already on the stack, e.g. an out parameter filled in place.
+struct slot {
+  int index;
+};
+
+/// The out parameter at |theIndex| if |theInPlace|, else |theLocal|, only
+/// then constructed.
+template <class T>
+T &out_arg(lua_State *L, int theIndex, std::optional<T> &theLocal,
+           bool theInPlace) {
+  if (!theInPlace)
+    return theLocal.emplace();
+
+  T *aValue = userdata_arg<T>(L, theIndex);
+
+  if (aValue == nullptr)
+    fail("invalid out argument " + std::to_string(theIndex));
+
+  return *aValue;
+}
+
+template <class V> bool push_one(lua_State *L, V &&theValue) {
+  if constexpr (std::is_same_v<std::decay_t<V>, slot>) {
+    lua_pushvalue(L, theValue.index);
+    return true;
+  } else {
+    return static_cast<bool>(
+        luabridge::Stack<std::decay_t<V>>::push(L, std::forward<V>(theValue)));
+  }
+}
+
+/// Pushes |theValues| as multiple results, e.g. of an in/out method, moved
+/// into Lua when given as rvalues.
+template <class... V> int push_results(lua_State *L, V &&...theValues) {
+  bool isPushed = (push_one(L, std::forward<V>(theValues)) && ...);
+
+  if (!isPushed)
+    fail("cannot push a result");
+
+  return static_cast<int>(sizeof...(V));
+}
+
+/// Self of a method: by class id, else through LuaBridge. |S| is const for
+/// a const method.
+template <class S> S *fast_self(lua_State *L) {
+  return userdata_arg<S>(L, 1);
+}
+
+template <class F, class... A, std::size_t... I>
+int call_at(lua_State *L, F theFn, std::tuple<A...> *,
+            std::index_sequence<I...>) {
+  using S = typename fn_traits<F>::self;
+  constexpr int aFirst = std::is_void_v<S> ? 1 : 2;
+
+  return protect(L, [&]() -> int {
+    auto anArgs =
+        std::make_tuple(get_arg<A>(L, aFirst + static_cast<int>(I))...);
+
+    if (!(static_cast<bool>(std::get<I>(anArgs)) && ...))
+      fail("invalid argument");
+
+    if constexpr (std::is_void_v<S>) {
+      return push_result(L, [&]() -> decltype(auto) {
+        return theFn(pass_arg<A>(*std::get<I>(anArgs))...);
+      });
+    } else {
+      S *aSelf = fast_self<S>(L);
+
+      if (aSelf == nullptr)
+        fail("invalid self");
+
+      return push_result(L, [&]() -> decltype(auto) {
+        return (aSelf->*theFn)(pass_arg<A>(*std::get<I>(anArgs))...);
+      });
+    }
+  });
+}
+
+/// Calls the candidate |theFn| of a dispatch, once its arguments match.
+template <class F> int call(lua_State *L, F theFn) {
+  using Args = typename fn_traits<F>::args;
+
+  return call_at(L, theFn, static_cast<Args *>(nullptr),
+                 std::make_index_sequence<std::tuple_size_v<Args>>{});
+}
+
+/// The error of a dispatch, once no candidate matched.
+inline int no_overload(lua_State *L, const char *theName) {
+  return luaL_error(L, "LuaOCCT: no overload of %s for %d arguments",
+                    theName, lua_gettop(L));
+}
+
+/// The conversions of the Stack of LuaBridge: a bool is the truth of any
+/// value, an integer or a real only a number, not a string, and an integer
+/// fits |T|.
+template <class T> bool fast_get(lua_State *L, int theIndex, T &theValue) {
+  int isValid = 0;
+
+  if constexpr (std::is_same_v<T, bool>) {
+    isValid = 1;
+    theValue = lua_toboolean(L, theIndex) != 0;
+  } else if constexpr (std::is_enum_v<T>) {
+    auto aValue = luabridge::get<T>(L, theIndex);
+    isValid = static_cast<bool>(aValue);
+
+    if (isValid)
+      theValue = *aValue;
+  } else if (lua_type(L, theIndex) != LUA_TNUMBER) {
+    isValid = 0;
+  } else if constexpr (std::is_integral_v<T>) {
+    lua_Integer aValue = lua_tointegerx(L, theIndex, &isValid);
+
+    if constexpr (std::is_signed_v<T>)
+      isValid = isValid && aValue >= (std::numeric_limits<T>::min)() &&
+                aValue <= (std::numeric_limits<T>::max)();
+    else
+      isValid = isValid && aValue >= 0 &&
+                static_cast<unsigned long long>(aValue) <=
+                    (std::numeric_limits<T>::max)();
+
+    theValue = static_cast<T>(aValue);
+  } else {
+    theValue = static_cast<T>(lua_tonumberx(L, theIndex, &isValid));
+  }
+
+  return isValid != 0;
+}
+
+/// The Lua type fast_get expects for |T|.
+template <class T> const char *fast_expected() {
+  if constexpr (std::is_same_v<T, bool>)
+    return "boolean";
+  else if constexpr (std::is_enum_v<T>)
+    return "enum value";
+  else if constexpr (std::is_integral_v<T>)
+    return "integer";
+  else
+    return "number";
+}
+
+template <class T> void fast_push(lua_State *L, T theValue) {
+  if constexpr (std::is_same_v<T, bool>)
+    lua_pushboolean(L, theValue ? 1 : 0);
+  else if constexpr (std::is_enum_v<T> || std::is_integral_v<T>)
+    lua_pushinteger(L, static_cast<lua_Integer>(theValue));
+  else
+    lua_pushnumber(L, static_cast<lua_Number>(theValue));
+}
+
+template <auto F, class... A, std::size_t... I>
+int fast_at(lua_State *L, std::tuple<A...> *, std::index_sequence<I...>) {
+  using S = typename fn_traits<decltype(F)>::self;
+  constexpr int aFirst = std::is_void_v<S> ? 1 : 2;
+
+  return protect(L, [&]() -> int {
+    std::tuple<arg_t<A>...> anArgs{};
+    std::size_t aBad = 0;
+    const char *anExpected = nullptr;
+
+    if (!((fast_get(L, aFirst + static_cast<int>(I), std::get<I>(anArgs)) ||
+           (aBad = I + 1, anExpected = fast_expected<arg_t<A>>(), false)) &&
+          ...))
+      fail("argument " + std::to_string(aBad) + ": " + anExpected +
+           " expected");
+
+    auto aCall = [&]() -> decltype(auto) {
+      if constexpr (std::is_void_v<S>) {
+        return F(std::get<I>(anArgs)...);
+      } else {
+        S *aSelf = fast_self<S>(L);
+
+        if (aSelf == nullptr)
+          fail("invalid self");
+
+        return (aSelf->*F)(std::get<I>(anArgs)...);
+      }
+    };
+
+    using R = decltype(aCall());
+
+    if constexpr (std::is_void_v<R>) {
+      aCall();
+      return 0;
+    } else {
+      fast_push<arg_t<R>>(L, aCall());
+      return 1;
+    }
+  });
+}
+
+/// The lua_CFunction of |F|, whose parameters and result are numbers,
+/// booleans or enums, without the Stack of LuaBridge.
+template <auto F> int fast(lua_State *L) {
+  using Args = typename fn_traits<decltype(F)>::args;
+
+  return fast_at<F>(L, static_cast<Args *>(nullptr),
+                    std::make_index_sequence<std::tuple_size_v<Args>>{});
+}
+
+/// The lua_CFunction of |F|, whose class result is constructed in place, see
+/// push_result.
+template <auto F> int emplace(lua_State *L) { return call(L, F); }
+
+} // namespace luaocct
+
+#endif
+)cpp";
+
+const char *const Binder_Support_Enum =
+    R"cpp(/* This file is generated, do not edit. */
+
+#ifndef _LuaOCCT_lenum_HeaderFile
+#define _LuaOCCT_lenum_HeaderFile
+
+#include <luaocct_bind/lbind.h>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace luaocct {
+
+/// The values [Min, Max] of a dense enum, checked by two comparisons.
+template <lua_Integer Min, lua_Integer Max> struct enum_range {
+  static bool contains(lua_Integer theValue) {
+    return theValue >= Min && theValue <= Max;
+  }
+};
+
+/// The |N| sorted values of a sparse enum, checked by a binary search.
+template <const lua_Integer *Values, std::size_t N> struct enum_sorted {
+  static bool contains(lua_Integer theValue) {
+    return std::binary_search(Values, Values + N, theValue);
+  }
+};
+
+/// luabridge::Stack of the enum |E|, an integer of |V|, i.e. enum_range or
+/// enum_sorted, instead of a linear scan of the values.
+template <class E, class V> struct enum_stack {
+  static luabridge::Result push(lua_State *L, E theValue) {
+    lua_pushinteger(L, static_cast<lua_Integer>(theValue));
+    return {};
+  }
+
+  static luabridge::TypeResult<E> get(lua_State *L, int theIndex) {
+    if (!isInstance(L, theIndex))
+      return luabridge::makeErrorCode(luabridge::ErrorCode::InvalidTypeCast);
+
+    return static_cast<E>(lua_tointeger(L, theIndex));
+  }
+
+  static bool isInstance(lua_State *L, int theIndex) {
+    int isInteger = 0;
+    lua_Integer aValue = lua_tointegerx(L, theIndex, &isInteger);
+
+    return isInteger != 0 && V::contains(aValue);
+  }
+};
+
+} // namespace luaocct
+
+#endif
+)cpp";
+
+const char *const Binder_Support_Plugin =
+    R"cpp(/* This file is generated, do not edit. */
+
+#ifndef _LuaOCCT_lplugin_HeaderFile
+#define _LuaOCCT_lplugin_HeaderFile
+
+#include <luaocct_bind/lbind.h>
+
+#if defined(_WIN32)
+#define LUAOCCT_PLUGIN_EXPORT extern "C" __declspec(dllexport)
+#else
+#define LUAOCCT_PLUGIN_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+namespace luaocct {
+
+/// require(theName)
+inline void require(lua_State *L, const char *theName) {
+  lua_getglobal(L, "require");
+  lua_pushstring(L, theName);
+  lua_call(L, 1, 0);
+}
+
+/// Raises an error unless |T| was registered before, e.g. by another plugin.
+template <class T> void check_base(lua_State *L, const char *theName) {
+  lua_rawgetp(L, LUA_REGISTRYINDEX,
+              luabridge::detail::getClassRegistryKey<T>());
+  bool isRegistered = lua_istable(L, -1);
+  lua_pop(L, 1);
+
+  if (!isRegistered)
+    luaL_error(L, "LuaOCCT: base class %s is not registered", theName);
+}
+
+/// LuaOCCT.<theModule>, the value of require.
+inline int module_table(lua_State *L, const char *theModule) {
+  lua_getglobal(L, "LuaOCCT");
+  lua_getfield(L, -1, theModule);
+  lua_remove(L, -2);
+
+  return 1;
+}
+
+} // namespace luaocct
+
+#endif
+)cpp";
+
+const char *const Binder_Support_Lazy =
+    R"cpp(/* This file is generated, do not edit. */
+
+#ifndef _LuaOCCT_llazy_HeaderFile
+#define _LuaOCCT_llazy_HeaderFile
+
+#include <luaocct_bind/lbind.h>
+
+#include <cstring>
+#include <string>
+
+namespace luaocct {
+
+/// A module, or a class of a module, registered on demand. |bases| are
+/// registered before it, |uses| after it. Both end with nullptr, or are
+/// null. A `Mod.Class` of another module is indexed.
+struct lazy_entry {
+  const char *name;
+  void (*init)(lua_State *L);
+  const char *const *bases;
+  const char *const *uses;
+};
+
+inline const lazy_entry *lazy_find(const lazy_entry *theEntries,
+                                   const char *theName) {
+  for (; theEntries->name != nullptr; ++theEntries) {
+    if (std::strcmp(theEntries->name, theName) == 0)
+      return theEntries;
+  }
+
+  return nullptr;
+}
+
+/// Indexes `LuaOCCT.Mod.Class`, which registers it.
+inline void lazy_touch(lua_State *L, const char *theDep) {
+  const char *aDot = std::strchr(theDep, '.');
+  std::string aModule{theDep, static_cast<std::size_t>(aDot - theDep)};
+
+  lua_getglobal(L, "LuaOCCT");
+  lua_getfield(L, -1, aModule.c_str());
+
+  if (lua_istable(L, -1))
+    lua_getfield(L, -1, aDot + 1);
+  else
+    lua_pushnil(L);
+
+  lua_pop(L, 3);
+}
+
+/// The state of |theEntry|: 0, 1 once registered, 2 once its uses are too.
+/// Sets it to |theState| if given.
+inline int lazy_state(lua_State *L, const lazy_entry *theEntries,
+                      const lazy_entry *theEntry, int theState = 0) {
+  // The states by name.
+  lua_rawgetp(L, LUA_REGISTRYINDEX, theEntries);
+
+  if (lua_isnil(L, -1)) {
+    lua_pop(L, 1);
+    lua_newtable(L);
+    lua_pushvalue(L, -1);
+    lua_rawsetp(L, LUA_REGISTRYINDEX, theEntries);
+  }
+
+  lua_getfield(L, -1, theEntry->name);
+  auto aState = static_cast<int>(lua_tointeger(L, -1));
+  lua_pop(L, 1);
+
+  if (theState != 0) {
+    lua_pushinteger(L, theState);
+    lua_setfield(L, -2, theEntry->name);
+  }
+
+  lua_pop(L, 1);
+
+  return aState;
+}
+
+/// Registers |theEntry| once, after its bases. The bases form no cycle, so
+/// a class is never registered before one of them.
+inline void lazy_register(lua_State *L, const lazy_entry *theEntries,
+                          const lazy_entry *theEntry) {
+  if (lazy_state(L, theEntries, theEntry) != 0)
+    return;
+
+  lazy_state(L, theEntries, theEntry, 1);
+
+  for (auto aBase = theEntry->bases; aBase && *aBase != nullptr; ++aBase) {
+    if (std::strchr(*aBase, '.') != nullptr)
+      lazy_touch(L, *aBase);
+    else if (const lazy_entry *anEntry = lazy_find(theEntries, *aBase))
+      lazy_register(L, theEntries, anEntry);
+  }
+
+  theEntry->init(L);
+}
+
+/// Registers |theEntry| and its bases, then what they use. The uses come
+/// after, so a cycle of uses, e.g. Standard_Transient and Standard_Type,
+/// ends and never registers a class before its base.
+inline void lazy_require(lua_State *L, const lazy_entry *theEntries,
+                         const lazy_entry *theEntry) {
+  lazy_register(L, theEntries, theEntry);
+
+  if (lazy_state(L, theEntries, theEntry) == 2)
+    return;
+
+  lazy_state(L, theEntries, theEntry, 2);
+
+  for (auto aBase = theEntry->bases; aBase && *aBase != nullptr; ++aBase) {
+    if (const lazy_entry *anEntry = lazy_find(theEntries, *aBase))
+      lazy_require(L, theEntries, anEntry);
+  }
+
+  for (auto aUse = theEntry->uses; aUse && *aUse != nullptr; ++aUse) {
+    if (std::strchr(*aUse, '.') != nullptr)
+      lazy_touch(L, *aUse);
+    else if (const lazy_entry *anEntry = lazy_find(theEntries, *aUse))
+      lazy_require(L, theEntries, anEntry);
+  }
+}
+
+/// __index of a lazy namespace, upvalues: the entries and the previous
+/// __index.
+inline int lazy_index(lua_State *L) {
+  const auto *anEntries =
+      static_cast<const lazy_entry *>(lua_touserdata(L, lua_upvalueindex(1)));
+
+  if (lua_type(L, 2) == LUA_TSTRING) {
+    if (const lazy_entry *anEntry = lazy_find(anEntries, lua_tostring(L, 2))) {
+      lazy_require(L, anEntries, anEntry);
+      lua_pushvalue(L, 2);
+      lua_rawget(L, 1);
+
+      if (!lua_isnil(L, -1))
+        return 1;
+
+      lua_pop(L, 1);
+    }
+  }
+
+  if (lua_isfunction(L, lua_upvalueindex(2))) {
+    lua_pushvalue(L, lua_upvalueindex(2));
+    lua_pushvalue(L, 1);
+    lua_pushvalue(L, 2);
+    lua_call(L, 2, 1);
+  } else if (lua_istable(L, lua_upvalueindex(2))) {
+    lua_pushvalue(L, 2);
+    lua_gettable(L, lua_upvalueindex(2));
+  } else {
+    lua_pushnil(L);
+  }
+
+  return 1;
+}
+
+/// Installs lazy_index on LuaOCCT, or on `LuaOCCT.<theModule>`, keeping the
+/// LuaBridge metatable of the namespace.
+inline void lazy_install(lua_State *L, const lazy_entry *theEntries,
+                         const char *theModule = nullptr) {
+  if (theModule != nullptr)
+    luabridge::getGlobalNamespace(L)
+        .beginNamespace("LuaOCCT")
+        .beginNamespace(theModule)
+        .endNamespace()
+        .endNamespace();
+  else
+    luabridge::getGlobalNamespace(L).beginNamespace("LuaOCCT").endNamespace();
+
+  lua_getglobal(L, "LuaOCCT");
+
+  // Not through the __index of LuaOCCT, the module is in progress.
+  if (theModule != nullptr) {
+    lua_pushstring(L, theModule);
+    lua_rawget(L, -2);
+    lua_remove(L, -2);
+  }
+
+  if (!lua_getmetatable(L, -1)) {
+    lua_newtable(L);
+    lua_pushvalue(L, -1);
+    lua_setmetatable(L, -3);
+  }
+
+  lua_pushlightuserdata(L, const_cast<lazy_entry *>(theEntries));
+  lua_getfield(L, -2, "__index");
+  lua_pushcclosure(L, &lazy_index, 2);
+  lua_setfield(L, -2, "__index");
+  lua_pop(L, 2);
+}
+
+} // namespace luaocct
+
+#endif
+)cpp";
+
+const char *const Binder_Support_Bench =
+    R"cpp(/* This file is generated, do not edit. */
+
+#ifndef _LuaOCCT_lbench_HeaderFile
+#define _LuaOCCT_lbench_HeaderFile
+
+#include <luaocct/luaocct.h>
+
+#include "lsupport.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace luaocct {
+
+struct bench_module {
+  const char *name;
+  void (*init)(lua_State *L);
+};
+
+/// Cost of a step: best wall time of the runs, allocations and heap growth
+/// of that run.
+struct bench_cost {
+  double us = -1;
+  std::size_t allocs = 0;
+  long long bytes = 0;
+};
+
+/// The lua_Alloc counting the allocations and the heap in use.
+struct bench_heap {
+  std::size_t allocs = 0;
+  long long bytes = 0;
+
+  static void *alloc(void *theUd, void *thePtr, std::size_t theOld,
+                     std::size_t theNew) {
+    auto *aHeap = static_cast<bench_heap *>(theUd);
+
+    // |theOld| is a type tag when |thePtr| is null.
+    long long anOld = thePtr != nullptr ? static_cast<long long>(theOld) : 0;
+
+    if (theNew == 0) {
+      aHeap->bytes -= anOld;
+      std::free(thePtr);
+      return nullptr;
+    }
+
+    void *aPtr = std::realloc(thePtr, theNew);
+
+    if (aPtr != nullptr) {
+      aHeap->allocs += thePtr == nullptr ? 1 : 0;
+      aHeap->bytes += static_cast<long long>(theNew) - anOld;
+    }
+
+    return aPtr;
+  }
+};
+
+template <class F>
+void bench_step(bench_heap &theHeap, bench_cost &theCost, F theStep) {
+  std::size_t anAllocs = theHeap.allocs;
+  long long aBytes = theHeap.bytes;
+  auto aStart = std::chrono::steady_clock::now();
+
+  theStep();
+
+  std::chrono::duration<double, std::micro> aTime =
+      std::chrono::steady_clock::now() - aStart;
+
+  if (theCost.us < 0 || aTime.count() < theCost.us) {
+    theCost.us = aTime.count();
+    theCost.allocs = theHeap.allocs - anAllocs;
+    theCost.bytes = theHeap.bytes - aBytes;
+  }
+}
+
+inline void bench_print(const char *theName, const bench_cost &theCost,
+                        bool theIsJson, bool theIsLast) {
+  if (theIsJson)
+    std::printf("    {\"name\": \"%s\", \"us\": %.1f, \"allocs\": %zu, "
+                "\"bytes\": %lld}%s\n",
+                theName, theCost.us, theCost.allocs, theCost.bytes,
+                theIsLast ? "" : ",");
+  else
+    std::printf("%-24s %12.1f %10zu %12lld\n", theName, theCost.us,
+                theCost.allocs, theCost.bytes);
+}
+
+/// A large result, e.g. a TColgp_Array1OfPnt.
+struct bench_array {
+  double values[1024] = {};
+};
+
+/// A class bound both ways, the generic LuaBridge path and luaocct::fast or
+/// luaocct::emplace.
+struct bench_point {
+  double x = 1;
+
+  double X() const { return x; }
+
+  void SetX(double theX) { x = theX; }
+
+  bench_array Samples() const {
+    bench_array anArray{};
+    anArray.values[0] = x;
+    return anArray;
+  }
+};
+
+/// Nanoseconds per call of the method |theName| of a bench_point, called
+/// from C with |theNbArgs| numbers.
+inline double bench_call(lua_State *L, const char *theName, int theNbArgs,
+                         int theNbCalls) {
+  lua_getfield(L, 1, theName);
+  auto aStart = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < theNbCalls; ++i) {
+    lua_pushvalue(L, -1);
+    lua_pushvalue(L, 1);
+
+    for (int k = 0; k < theNbArgs; ++k)
+      lua_pushnumber(L, static_cast<lua_Number>(i));
+
+    lua_call(L, theNbArgs + 1, 0);
+  }
+
+  std::chrono::duration<double, std::nano> aTime =
+      std::chrono::steady_clock::now() - aStart;
+  lua_pop(L, 1);
+
+  return aTime.count() / theNbCalls;
+}
+
+/// Per call overhead of a numeric getter and setter, LuaBridge and fast,
+/// and of an 8 KiB result, LuaBridge and emplace.
+inline void bench_calls(int theNbCalls, bool theIsJson) {
+  bench_heap aHeap{};
+  lua_State *L = lua_newstate(&bench_heap::alloc, &aHeap);
+
+  luabridge::getGlobalNamespace(L)
+      .beginClass<bench_array>("bench_array")
+      .endClass()
+      .beginClass<bench_point>("bench_point")
+      .addFunction("X", &bench_point::X)
+      .addFunction("SetX", &bench_point::SetX)
+      .addFunction("FastX", &luaocct::fast<&bench_point::X>)
+      .addFunction("FastSetX", &luaocct::fast<&bench_point::SetX>)
+      .addFunction("Samples", &bench_point::Samples)
+      .addFunction("EmplaceSamples", &luaocct::emplace<&bench_point::Samples>)
+      .endClass();
+  luabridge::push(L, bench_point{});
+
+  const char *const NAMES[] = {"X",        "FastX",   "SetX",
+                               "FastSetX", "Samples", "EmplaceSamples"};
+  const int NB_ARGS[] = {0, 0, 1, 1, 0, 0};
+  double aTimes[6];
+
+  for (int i = 0; i < 6; ++i)
+    aTimes[i] = bench_call(L, NAMES[i], NB_ARGS[i], theNbCalls);
+
+  lua_close(L);
+
+  if (theIsJson) {
+    std::printf("  \"calls\": {\"count\": %d", theNbCalls);
+
+    for (int i = 0; i < 6; ++i)
+      std::printf(", \"%s_ns\": %.1f", NAMES[i], aTimes[i]);
+
+    std::printf("},\n");
+  } else {
+    std::printf("\n%-24s %12s\n", "call", "ns");
+
+    for (int i = 0; i < 6; ++i)
+      std::printf("%-24s %12.1f\n", NAMES[i], aTimes[i]);
+
+    std::printf("\n");
+  }
+}
+
+/// Usage: lbench [runs] [--json]. Times each module init in the order of
+/// luaopen_luaocct, in one state, then luaopen_luaocct in a fresh state,
+/// indexing every module so that the lazy ones are loaded too.
+/// Then the calls of a numeric method, through LuaBridge and luaocct::fast,
+/// and of a method returning a large value, through LuaBridge and
+/// luaocct::emplace.
+inline int bench_main(int argc, char *argv[], const bench_module *theModules,
+                      int (*theOpen)(lua_State *L)) {
+  int aNbRuns = 10;
+  bool isJson = false;
+
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--json") == 0)
+      isJson = true;
+    else
+      aNbRuns = std::max(1, std::atoi(argv[i]));
+  }
+
+  std::size_t aNbModules = 0;
+  while (theModules[aNbModules].name != nullptr)
+    aNbModules++;
+
+  std::vector<bench_cost> aCosts(aNbModules);
+  bench_cost aTotal{};
+
+  for (int aRun = 0; aRun < aNbRuns; ++aRun) {
+    bench_heap aHeap{};
+    lua_State *L = lua_newstate(&bench_heap::alloc, &aHeap);
+
+    for (std::size_t i = 0; i < aNbModules; ++i)
+      bench_step(aHeap, aCosts[i], [&]() { theModules[i].init(L); });
+
+    lua_close(L);
+
+    bench_heap anOpenHeap{};
+    L = lua_newstate(&bench_heap::alloc, &anOpenHeap);
+    bench_step(anOpenHeap, aTotal, [&]() {
+      theOpen(L);
+      lua_getglobal(L, "LuaOCCT");
+
+      for (std::size_t i = 0; i < aNbModules; ++i) {
+        lua_getfield(L, -1, theModules[i].name);
+        lua_pop(L, 1);
+      }
+
+      lua_pop(L, 1);
+    });
+    lua_close(L);
+  }
+
+  if (isJson)
+    std::printf("{\n  \"runs\": %d,\n", aNbRuns);
+
+  bench_calls(1000000, isJson);
+
+  if (isJson)
+    std::printf("  \"modules\": [\n");
+  else
+    std::printf("%-24s %12s %10s %12s\n", "module", "us", "allocs", "bytes");
+
+  for (std::size_t i = 0; i < aNbModules; ++i)
+    bench_print(theModules[i].name, aCosts[i], isJson, i + 1 == aNbModules);
+
+  if (isJson) {
+    std::printf("  ],\n  \"total\":\n");
+    bench_print("luaopen_luaocct", aTotal, true, true);
+    std::printf("}\n");
+  } else {
+    bench_print("luaopen_luaocct", aTotal, false, true);
+  }
+
+  return 0;
+}
+
+} // namespace luaocct
+
+#endif
+)cpp";
@@ -0,0 +1,24 @@
+#ifndef _LuaOCCT_Binder_Support_HeaderFile
+#define _LuaOCCT_Binder_Support_HeaderFile
+
+/// Hand-written helpers exported along with the generated bindings.
+
+/// lcollection.h, binders shared by all NCollection instantiations.
+extern const char *const Binder_Support_Collection;
+
+/// lsupport.h, function templates replacing the per-binding lambdas.
+extern const char *const Binder_Support_Helpers;
+
+/// lenum.h, the luabridge::Stack of the enums.
+extern const char *const Binder_Support_Enum;
+
+/// lplugin.h, runtime of the per-module Lua C modules.
+extern const char *const Binder_Support_Plugin;
+
+/// llazy.h, registration of the modules on first use.
+extern const char *const Binder_Support_Lazy;
+
+/// lbench.h, the startup and call benchmark of lbench.cpp.
+extern const char *const Binder_Support_Bench;
+
+#endif
@@ -0,0 +1,23 @@
+-- GeomConvert.ConcatG1 of binder.toml: two collinear segments are joined
+-- into one B-spline, given and returned as Lua tables of curves.
+require("luaocct")
+
+local gp_Pnt = LuaOCCT.gp.gp_Pnt
+local Geom_BSplineCurve = LuaOCCT.Geom.Geom_BSplineCurve
+local GeomConvert = LuaOCCT.GeomConvert.GeomConvert
+
+local function segment(theFrom, theTo)
+  return Geom_BSplineCurve({ gp_Pnt(theFrom, 0, 0), gp_Pnt(theTo, 0, 0) },
+    { 0, 1 }, { 2, 2 }, 1, false)
+end
+
+local aCurves, isClosed =
+    GeomConvert.ConcatG1({ segment(0, 1), segment(1, 2) }, { 1e-7 }, false,
+      1e-7)
+
+assert(#aCurves == 1, "ConcatG1: one curve expected, got " .. #aCurves)
+assert(not isClosed, "ConcatG1: an open curve expected")
+assert(aCurves[1]:StartPoint():IsEqual(gp_Pnt(0, 0, 0), 1e-7))
+assert(aCurves[1]:EndPoint():IsEqual(gp_Pnt(2, 0, 0), 1e-7))
+
+print("GeomConvert.ConcatG1: ok")